@@ -0,0 +1,511 @@
+/* assets.h
+ * generated by palpack from background.h, cars.h and text.h */
+
+#define bg_palette_size 16
+const unsigned short bg_palette_data [] = {
+    0x7c1f, 0x7e4b, 0x35ad, 0x3def, 0x7fff, 0x03df, 0x5ad6, 0x6318, 0x5ef7, 
+    0x0000, 0x7ee7, 0x02a0, 0x6527, 0x0b50, 0x0000, 0x0000
+};
+
+#define obj_palette_size 16
+const unsigned short obj_palette_data [] = {
+    0x7c1f, 0x0c58, 0x107d, 0x6f31, 0x7773, 0x7fff, 0x1e23, 0x26c4, 0x0000, 
+    0x0c57, 0x318c, 0x3def, 0x59e0, 0x7680, 0x0000, 0x0000
+};
+
+#define background_width 88
+#define background_height 48
+
+const unsigned char background_data [] = {
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x03, 0x03, 
+    0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 
+    0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x03, 
+    0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 
+    0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+    0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 0x03, 0x02, 0x02, 
+    0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x03, 
+    0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x02, 0x03, 
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 
+    0x03, 0x03, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 
+    0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 
+    0x03, 0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+    0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 
+    0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+    0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x04, 
+    0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 
+    0x03, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 
+    0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+    0x03, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 
+    0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 
+    0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 
+    0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 
+    0x05, 0x05, 0x05, 0x05, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x03, 
+    0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 
+    0x02, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 
+    0x03, 0x03, 0x03, 0x02, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x03, 0x02, 
+    0x03, 0x02, 0x02, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 
+    0x06, 0x07, 0x08, 0x07, 0x07, 0x08, 0x07, 0x07, 0x06, 0x08, 0x07, 0x08, 
+    0x08, 0x07, 0x08, 0x07, 0x06, 0x07, 0x07, 0x07, 0x07, 0x08, 0x08, 0x08, 
+    0x06, 0x08, 0x07, 0x08, 0x08, 0x07, 0x08, 0x07, 0x06, 0x07, 0x07, 0x07, 
+    0x07, 0x07, 0x07, 0x08, 0x06, 0x07, 0x08, 0x08, 0x07, 0x07, 0x08, 0x08, 
+    0x06, 0x07, 0x07, 0x08, 0x07, 0x08, 0x08, 0x07, 0x06, 0x06, 0x06, 0x06, 
+    0x06, 0x06, 0x06, 0x06, 0x08, 0x07, 0x07, 0x07, 0x07, 0x08, 0x07, 0x06, 
+    0x08, 0x07, 0x07, 0x08, 0x08, 0x07, 0x08, 0x06, 0x07, 0x08, 0x08, 0x07, 
+    0x07, 0x08, 0x07, 0x06, 0x08, 0x08, 0x07, 0x07, 0x08, 0x07, 0x08, 0x06, 
+    0x07, 0x07, 0x08, 0x07, 0x08, 0x07, 0x07, 0x06, 0x08, 0x07, 0x07, 0x08, 
+    0x07, 0x08, 0x07, 0x06, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x06, 
+    0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x09, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x04, 0x09, 0x01, 0x01, 0x01, 0x01, 
+    0x04, 0x04, 0x04, 0x09, 0x01, 0x09, 0x01, 0x01, 0x04, 0x04, 0x04, 0x04, 
+    0x09, 0x04, 0x09, 0x01, 0x04, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 
+    0x04, 0x04, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x09, 0x04, 0x04, 0x04, 0x04, 
+    0x04, 0x04, 0x04, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x02, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+    0x02, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 
+    0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 0x03, 
+    0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 
+    0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 
+    0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x02, 
+    0x02, 0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 
+    0x02, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 
+    0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x02, 
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 
+    0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 
+    0x02, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 
+    0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+    0x02, 0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+    0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x02, 0x03, 0x03, 
+    0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 
+    0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 
+    0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 
+    0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 
+    0x03, 0x03, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x02, 0x02, 0x03, 0x03, 
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x02, 
+    0x02, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 
+    0x03, 0x03, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x05, 0x05, 0x05, 0x05, 
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x03, 
+    0x03, 0x02, 0x02, 0x03, 0x02, 0x03, 0x03, 0x02, 0x03, 0x03, 0x03, 0x02, 
+    0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 0x02, 
+    0x02, 0x03, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x02, 0x03, 0x03, 
+    0x06, 0x07, 0x08, 0x08, 0x08, 0x07, 0x08, 0x07, 0x06, 0x07, 0x08, 0x07, 
+    0x07, 0x07, 0x08, 0x07, 0x06, 0x07, 0x07, 0x08, 0x08, 0x07, 0x08, 0x08, 
+    0x06, 0x08, 0x07, 0x08, 0x07, 0x08, 0x08, 0x07, 0x06, 0x07, 0x07, 0x08, 
+    0x07, 0x07, 0x08, 0x08, 0x06, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 
+    0x06, 0x07, 0x07, 0x07, 0x07, 0x08, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 
+    0x06, 0x06, 0x06, 0x06, 0x08, 0x08, 0x07, 0x07, 0x08, 0x08, 0x08, 0x06, 
+    0x07, 0x08, 0x08, 0x07, 0x08, 0x07, 0x07, 0x06, 0x07, 0x07, 0x07, 0x07, 
+    0x07, 0x08, 0x08, 0x06, 0x08, 0x07, 0x08, 0x07, 0x08, 0x08, 0x07, 0x06, 
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0x07, 0x06, 0x07, 0x08, 0x08, 0x07, 
+    0x07, 0x08, 0x08, 0x06, 0x08, 0x07, 0x08, 0x07, 0x08, 0x08, 0x07, 0x06, 
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x04, 0x04, 
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 
+    0x09, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x09, 0x04, 
+    0x09, 0x01, 0x01, 0x01, 0x04, 0x09, 0x04, 0x04, 0x09, 0x01, 0x01, 0x01, 
+    0x04, 0x04, 0x04, 0x04, 0x09, 0x01, 0x09, 0x01, 0x04, 0x04, 0x04, 0x04, 
+    0x04, 0x09, 0x04, 0x09, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 0x04, 0x04, 0x04, 0x04, 
+    0x04, 0x04, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x01, 
+    0x04, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0b, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0b, 0x0b, 0x01, 0x01, 0x01, 0x01, 
+    0x09, 0x0b, 0x0b, 0x0b, 0x01, 0x01, 0x01, 0x09, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 0x04, 0x01, 0x01, 0x09, 0x09, 
+    0x09, 0x0b, 0x0b, 0x04, 0x09, 0x09, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x04, 0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x04, 0x0b, 0x0b, 0x09, 0x09, 0x09, 0x01, 0x01, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x09, 0x09, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x0b, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x0b, 0x0b, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0b, 0x0b, 0x0b, 0x09, 
+    0x01, 0x01, 0x01, 0x01, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x01, 0x01, 0x01, 
+    0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x04, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0c, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x04, 
+    0x04, 0x0a, 0x04, 0x04, 0x01, 0x01, 0x01, 0x09, 0x04, 0x04, 0x0a, 0x04, 
+    0x01, 0x01, 0x01, 0x01, 0x09, 0x04, 0x04, 0x0a, 0x01, 0x01, 0x01, 0x01, 
+    0x09, 0x04, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 0x09, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0a, 0x04, 0x04, 
+    0x04, 0x04, 0x04, 0x04, 0x0a, 0x0a, 0x0a, 0x04, 0x04, 0x04, 0x0a, 0x0a, 
+    0x04, 0x04, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x04, 0x04, 0x04, 0x04, 
+    0x0a, 0x0a, 0x04, 0x04, 0x09, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 
+    0x01, 0x09, 0x09, 0x04, 0x04, 0x04, 0x09, 0x01, 0x01, 0x01, 0x01, 0x09, 
+    0x09, 0x09, 0x01, 0x01, 0x04, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 
+    0x0a, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0a, 0x0a, 0x04, 0x04, 
+    0x04, 0x04, 0x0a, 0x04, 0x04, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x04, 0x04, 
+    0x04, 0x04, 0x0a, 0x0a, 0x0a, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 
+    0x04, 0x04, 0x04, 0x04, 0x09, 0x09, 0x04, 0x04, 0x04, 0x04, 0x09, 0x09, 
+    0x01, 0x01, 0x09, 0x09, 0x09, 0x09, 0x01, 0x01, 0x04, 0x04, 0x04, 0x04, 
+    0x04, 0x09, 0x01, 0x01, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 0x01, 
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 0x04, 0x04, 0x04, 0x04, 
+    0x04, 0x04, 0x04, 0x01, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 0x09, 0x01, 
+    0x09, 0x04, 0x04, 0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x09, 0x0b, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0b, 0x0b, 
+    0x01, 0x01, 0x01, 0x01, 0x09, 0x0b, 0x0b, 0x0b, 0x01, 0x01, 0x01, 0x09, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x01, 0x01, 0x09, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x01, 0x09, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x01, 0x01, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x01, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x09, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x0b, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x0b, 0x0b, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0b, 0x0b, 0x0b, 0x09, 
+    0x01, 0x01, 0x01, 0x01, 0x0b, 0x0b, 0x0b, 0x0b, 0x09, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x09, 0x0d, 0x0d, 0x01, 0x01, 0x01, 0x09, 0x09, 0x0d, 0x0d, 0x0d, 
+    0x01, 0x01, 0x09, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x01, 0x01, 0x09, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x01, 0x01, 0x09, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x01, 0x09, 0x0d, 0x0d, 0x0d, 0x0b, 0x0b, 0x0d, 0x09, 0x0d, 0x0d, 0x0d, 
+    0x0b, 0x0d, 0x0d, 0x0d, 0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x0d, 0x0d, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0d, 0x0d, 0x0d, 0x09, 
+    0x01, 0x01, 0x01, 0x01, 0x0d, 0x0d, 0x0d, 0x09, 0x01, 0x09, 0x01, 0x01, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x0d, 0x09, 0x01, 0x0d, 0x0b, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x09, 0x0d, 0x0d, 0x0b, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0d, 0x0d, 
+    0x01, 0x01, 0x01, 0x09, 0x09, 0x0d, 0x0d, 0x0d, 0x01, 0x01, 0x09, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x01, 0x01, 0x09, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x01, 0x01, 0x09, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x01, 0x09, 0x0d, 0x0d, 
+    0x0d, 0x0b, 0x0b, 0x0d, 0x09, 0x0d, 0x0d, 0x0d, 0x0b, 0x0d, 0x0d, 0x0d, 
+    0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0d, 0x0d, 0x09, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x0d, 0x0d, 0x0d, 0x09, 0x01, 0x01, 0x01, 0x01, 
+    0x0d, 0x0d, 0x0d, 0x09, 0x01, 0x09, 0x01, 0x01, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x09, 0x0d, 0x09, 0x01, 0x0d, 0x0b, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 
+    0x0d, 0x0d, 0x0b, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x0d, 0x0d, 0x01, 0x01, 0x01, 0x09, 
+    0x09, 0x0d, 0x0d, 0x0d, 0x01, 0x01, 0x09, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x01, 0x01, 0x09, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x01, 0x01, 0x09, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x01, 0x09, 0x0d, 0x0d, 0x0d, 0x0b, 0x0b, 0x0d, 
+    0x09, 0x0d, 0x0d, 0x0d, 0x0b, 0x0d, 0x0d, 0x0d, 0x09, 0x09, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x0d, 0x0d, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x0d, 0x0d, 0x0d, 0x09, 0x01, 0x01, 0x01, 0x01, 0x0d, 0x0d, 0x0d, 0x09, 
+    0x01, 0x09, 0x01, 0x01, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x0d, 0x09, 0x01, 
+    0x0d, 0x0b, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x0d, 0x0d, 0x0b, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x09, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 0x09, 
+    0x01, 0x01, 0x01, 0x01, 0x09, 0x0d, 0x0d, 0x0d, 0x01, 0x01, 0x01, 0x09, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x01, 0x01, 0x01, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x01, 0x09, 0x09, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x01, 0x09, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x01, 0x01, 0x09, 
+    0x01, 0x01, 0x01, 0x01, 0x09, 0x01, 0x09, 0x0d, 0x09, 0x01, 0x01, 0x01, 
+    0x0d, 0x09, 0x0d, 0x0d, 0x09, 0x01, 0x01, 0x01, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x09, 0x01, 0x09, 0x01, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x0d, 0x09, 
+    0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x0d, 0x0d, 0x0d, 0x0d, 
+    0x0d, 0x0d, 0x0d, 0x09, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x09, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const unsigned char text_remap [] = {
+    0x00, 0x09, 0x04
+};
+
+#define cars_width 32
+#define cars_height 48
+
+const unsigned char cars_data [] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 
+    0x00, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x00, 0x01, 0x02, 0x02, 
+    0x01, 0x03, 0x03, 0x01, 0x00, 0x01, 0x02, 0x02, 0x01, 0x04, 0x04, 0x03, 
+    0x00, 0x01, 0x05, 0x05, 0x01, 0x04, 0x04, 0x03, 0x00, 0x01, 0x02, 0x02, 
+    0x01, 0x04, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x04, 
+    0x04, 0x04, 0x04, 0x04, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 
+    0x02, 0x02, 0x02, 0x02, 0x01, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 
+    0x03, 0x01, 0x02, 0x02, 0x02, 0x01, 0x03, 0x03, 0x03, 0x01, 0x02, 0x02, 
+    0x01, 0x03, 0x03, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x03, 0x04, 0x04, 
+    0x04, 0x01, 0x05, 0x05, 0x01, 0x03, 0x04, 0x04, 0x04, 0x01, 0x02, 0x02, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 
+    0x02, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 
+    0x02, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x01, 0x04, 0x04, 0x03, 
+    0x00, 0x01, 0x05, 0x05, 0x01, 0x04, 0x04, 0x03, 0x00, 0x01, 0x02, 0x02, 
+    0x01, 0x04, 0x04, 0x03, 0x00, 0x01, 0x02, 0x02, 0x01, 0x04, 0x04, 0x01, 
+    0x00, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x00, 0x00, 0x01, 0x02, 
+    0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x02, 
+    0x02, 0x02, 0x02, 0x02, 0x01, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 
+    0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x01, 0x03, 0x04, 0x04, 0x04, 0x01, 0x02, 0x02, 0x01, 0x03, 0x04, 0x04, 
+    0x04, 0x01, 0x05, 0x05, 0x01, 0x03, 0x04, 0x04, 0x04, 0x01, 0x01, 0x01, 
+    0x02, 0x01, 0x04, 0x04, 0x04, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 
+    0x04, 0x01, 0x02, 0x02, 0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 
+    0x01, 0x01, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 
+    0x00, 0x00, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x00, 0x06, 0x07, 0x07, 
+    0x07, 0x06, 0x06, 0x07, 0x00, 0x06, 0x07, 0x07, 0x06, 0x03, 0x03, 0x06, 
+    0x00, 0x06, 0x07, 0x07, 0x06, 0x04, 0x04, 0x03, 0x00, 0x06, 0x07, 0x07, 
+    0x06, 0x04, 0x04, 0x03, 0x00, 0x06, 0x07, 0x07, 0x06, 0x04, 0x04, 0x03, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 
+    0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x07, 
+    0x07, 0x07, 0x07, 0x07, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 
+    0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x07, 0x07, 0x07, 
+    0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x06, 0x07, 0x07, 
+    0x07, 0x06, 0x06, 0x07, 0x06, 0x07, 0x07, 0x06, 0x06, 0x03, 0x06, 0x07, 
+    0x07, 0x07, 0x06, 0x03, 0x03, 0x03, 0x06, 0x07, 0x07, 0x06, 0x03, 0x03, 
+    0x04, 0x04, 0x06, 0x07, 0x07, 0x06, 0x03, 0x04, 0x04, 0x04, 0x06, 0x07, 
+    0x07, 0x06, 0x03, 0x04, 0x04, 0x04, 0x06, 0x07, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x00, 0x00, 0x07, 0x07, 0x07, 0x07, 
+    0x07, 0x07, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x00, 
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 
+    0x07, 0x07, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x00, 
+    0x00, 0x06, 0x07, 0x07, 0x06, 0x04, 0x04, 0x03, 0x00, 0x06, 0x07, 0x07, 
+    0x06, 0x04, 0x04, 0x03, 0x00, 0x06, 0x07, 0x07, 0x06, 0x04, 0x04, 0x03, 
+    0x00, 0x06, 0x07, 0x07, 0x06, 0x04, 0x04, 0x06, 0x00, 0x06, 0x07, 0x07, 
+    0x07, 0x06, 0x06, 0x07, 0x00, 0x00, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 
+    0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 
+    0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x07, 0x07, 0x07, 
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 
+    0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03, 0x03, 0x03, 
+    0x03, 0x03, 0x03, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x06, 0x03, 0x04, 
+    0x04, 0x04, 0x06, 0x07, 0x07, 0x06, 0x03, 0x04, 0x04, 0x04, 0x06, 0x07, 
+    0x07, 0x06, 0x03, 0x04, 0x04, 0x04, 0x06, 0x07, 0x07, 0x07, 0x06, 0x04, 
+    0x04, 0x04, 0x06, 0x07, 0x06, 0x07, 0x07, 0x06, 0x06, 0x04, 0x06, 0x07, 
+    0x03, 0x06, 0x07, 0x07, 0x07, 0x06, 0x06, 0x07, 0x06, 0x06, 0x06, 0x06, 
+    0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 
+    0x07, 0x07, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x00, 
+    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 
+    0x07, 0x07, 0x06, 0x00, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x00, 0x00, 
+    0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x05, 0x08, 
+    0x08, 0x08, 0x08, 0x08, 0x00, 0x05, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 
+    0x00, 0x05, 0x08, 0x08, 0x08, 0x03, 0x03, 0x08, 0x00, 0x05, 0x08, 0x08, 
+    0x08, 0x04, 0x04, 0x03, 0x00, 0x05, 0x08, 0x08, 0x08, 0x04, 0x04, 0x03, 
+    0x00, 0x05, 0x08, 0x08, 0x08, 0x04, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 
+    0x05, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 
+    0x05, 0x05, 0x05, 0x05, 0x08, 0x05, 0x05, 0x05, 0x09, 0x09, 0x05, 0x05, 
+    0x08, 0x05, 0x05, 0x05, 0x09, 0x02, 0x05, 0x05, 0x08, 0x05, 0x05, 0x05, 
+    0x09, 0x02, 0x05, 0x05, 0x08, 0x05, 0x05, 0x05, 0x0a, 0x0b, 0x05, 0x05, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x05, 0x08, 0x08, 
+    0x08, 0x08, 0x08, 0x08, 0x04, 0x05, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 
+    0x05, 0x05, 0x08, 0x08, 0x08, 0x03, 0x08, 0x08, 0x05, 0x08, 0x08, 0x03, 
+    0x03, 0x03, 0x03, 0x08, 0x05, 0x08, 0x03, 0x03, 0x04, 0x04, 0x04, 0x08, 
+    0x05, 0x08, 0x03, 0x04, 0x04, 0x04, 0x04, 0x08, 0x05, 0x08, 0x03, 0x04, 
+    0x04, 0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 
+    0x08, 0x05, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x05, 0x00, 
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x05, 0x00, 0x08, 0x08, 0x08, 0x08, 
+    0x08, 0x08, 0x05, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x05, 0x00, 
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x05, 0x00, 0x00, 0x05, 0x08, 0x08, 
+    0x08, 0x04, 0x04, 0x03, 0x00, 0x05, 0x08, 0x08, 0x08, 0x04, 0x04, 0x03, 
+    0x00, 0x05, 0x08, 0x08, 0x08, 0x04, 0x04, 0x03, 0x00, 0x05, 0x08, 0x08, 
+    0x08, 0x04, 0x04, 0x08, 0x00, 0x05, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 
+    0x00, 0x00, 0x05, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x08, 
+    0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x08, 0x05, 0x05, 0x05, 0x0a, 0x0b, 0x05, 0x05, 0x08, 0x05, 0x05, 0x05, 
+    0x0c, 0x0d, 0x05, 0x05, 0x08, 0x05, 0x05, 0x05, 0x0c, 0x0d, 0x05, 0x05, 
+    0x08, 0x05, 0x05, 0x05, 0x0c, 0x0d, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x08, 0x03, 0x04, 0x04, 0x04, 0x04, 0x08, 
+    0x05, 0x08, 0x03, 0x04, 0x04, 0x04, 0x04, 0x08, 0x05, 0x08, 0x03, 0x04, 
+    0x04, 0x04, 0x04, 0x08, 0x05, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x08, 
+    0x05, 0x05, 0x08, 0x08, 0x08, 0x04, 0x08, 0x08, 0x03, 0x05, 0x08, 0x08, 
+    0x08, 0x08, 0x08, 0x08, 0x05, 0x05, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 
+    0x08, 0x08, 0x05, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x05, 0x00, 
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x05, 0x00, 0x08, 0x08, 0x08, 0x08, 
+    0x08, 0x08, 0x05, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x05, 0x00, 
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x05, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
@@ -0,0 +1,144 @@
+/* font.h
+ * generated by fontpack from text.h
+ * 1536 bytes, the font at 8 bits per pixel is 6144 bytes */
+
+#define font_glyphs 96
+#define font_first_char 32
+#define font_bits 2
+
+/* the palette index drawn for each code */
+const unsigned char font_colors [] = {
+    0x00, 0x09, 0x04, 0x00
+};
+
+/* the glyphs in tile order, 4 pixels to a byte with the leftmost in the lowest bits */
+const unsigned char font_data [] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x94, 0x16, 0xa4, 0x1a, 0xa4, 0x1a, 
+    0x94, 0x16, 0x50, 0x05, 0x90, 0x06, 0x50, 0x05, 0x54, 0x15, 0x65, 0x19, 
+    0x59, 0x16, 0x69, 0x1a, 0x69, 0x1a, 0x55, 0x15, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x69, 0x00, 0x65, 0x00, 0x59, 0x00, 
+    0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x50, 0x06, 
+    0x90, 0x05, 0x90, 0x01, 0x90, 0x01, 0x90, 0x05, 0x50, 0x06, 0x40, 0x05, 
+    0x50, 0x01, 0x90, 0x05, 0x50, 0x06, 0x40, 0x06, 0x40, 0x06, 0x50, 0x06, 
+    0x90, 0x05, 0x50, 0x01, 0x00, 0x00, 0x15, 0x15, 0x59, 0x19, 0x65, 0x16, 
+    0x94, 0x05, 0x65, 0x16, 0x59, 0x19, 0x15, 0x15, 0x00, 0x00, 0x40, 0x05, 
+    0x40, 0x06, 0x54, 0x56, 0xa4, 0x6a, 0x54, 0x56, 0x40, 0x06, 0x40, 0x05, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x69, 0x00, 0x65, 0x00, 
+    0x59, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 
+    0xa9, 0x6a, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x69, 0x00, 0x69, 0x00, 0x55, 0x00, 
+    0x00, 0x15, 0x00, 0x19, 0x40, 0x16, 0x40, 0x06, 0x90, 0x05, 0x90, 0x01, 
+    0x64, 0x01, 0x54, 0x00, 0x00, 0x00, 0x54, 0x15, 0xa5, 0x5a, 0x69, 0x69, 
+    0x69, 0x69, 0x69, 0x69, 0xa5, 0x5a, 0x54, 0x15, 0x00, 0x00, 0x54, 0x05, 
+    0xa4, 0x06, 0x94, 0x06, 0x90, 0x06, 0x94, 0x16, 0xa4, 0x1a, 0x54, 0x15, 
+    0x00, 0x00, 0x55, 0x15, 0xa9, 0x5a, 0x55, 0x69, 0xa5, 0x5a, 0x69, 0x55, 
+    0xa9, 0x6a, 0x55, 0x55, 0x00, 0x00, 0x55, 0x15, 0xa9, 0x5a, 0x55, 0x69, 
+    0xa4, 0x5a, 0x55, 0x69, 0xa9, 0x5a, 0x55, 0x15, 0x00, 0x00, 0x55, 0x15, 
+    0x69, 0x19, 0x69, 0x19, 0x69, 0x59, 0xa9, 0x6a, 0x55, 0x59, 0x00, 0x15, 
+    0x00, 0x00, 0x55, 0x15, 0xa9, 0x1a, 0x69, 0x15, 0xa9, 0x5a, 0x55, 0x69, 
+    0xa9, 0x5a, 0x55, 0x15, 0x00, 0x00, 0x54, 0x15, 0xa5, 0x1a, 0x69, 0x15, 
+    0xa9, 0x5a, 0x69, 0x69, 0xa5, 0x5a, 0x54, 0x15, 0x00, 0x00, 0x55, 0x55, 
+    0xa9, 0x6a, 0x55, 0x69, 0x50, 0x5a, 0x94, 0x16, 0xa4, 0x05, 0x54, 0x01, 
+    0x00, 0x00, 0x54, 0x15, 0xa5, 0x5a, 0x69, 0x69, 0xa5, 0x5a, 0x69, 0x69, 
+    0xa5, 0x5a, 0x54, 0x15, 0x00, 0x00, 0x54, 0x15, 0xa5, 0x5a, 0x69, 0x69, 
+    0xa5, 0x6a, 0x54, 0x69, 0xa4, 0x5a, 0x54, 0x15, 0x50, 0x05, 0x90, 0x06, 
+    0x90, 0x06, 0x50, 0x05, 0x90, 0x06, 0x90, 0x06, 0x50, 0x05, 0x00, 0x00, 
+    0x40, 0x15, 0x40, 0x1a, 0x40, 0x1a, 0x40, 0x15, 0x40, 0x1a, 0x40, 0x19, 
+    0x40, 0x16, 0x40, 0x05, 0x00, 0x00, 0x40, 0x15, 0x50, 0x1a, 0x94, 0x15, 
+    0x64, 0x01, 0x94, 0x15, 0x50, 0x1a, 0x40, 0x15, 0x00, 0x00, 0x00, 0x00, 
+    0x55, 0x15, 0xa9, 0x1a, 0x55, 0x15, 0xa9, 0x1a, 0x55, 0x15, 0x00, 0x00, 
+    0x00, 0x00, 0x54, 0x01, 0xa4, 0x05, 0x54, 0x16, 0x40, 0x19, 0x54, 0x16, 
+    0xa4, 0x05, 0x54, 0x01, 0x54, 0x15, 0xa5, 0x5a, 0x69, 0x69, 0x55, 0x5a, 
+    0x90, 0x16, 0x50, 0x05, 0x90, 0x06, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x54, 0x15, 0xa5, 0x5a, 0x69, 0x69, 0x69, 0x69, 0xa9, 0x6a, 0x69, 0x69, 
+    0x69, 0x69, 0x55, 0x55, 0x55, 0x15, 0xa9, 0x5a, 0x69, 0x69, 0xa9, 0x5a, 
+    0x69, 0x69, 0x69, 0x69, 0xa9, 0x5a, 0x55, 0x15, 0x54, 0x15, 0xa5, 0x5a, 
+    0x69, 0x69, 0x69, 0x55, 0x69, 0x55, 0x69, 0x69, 0xa5, 0x5a, 0x54, 0x15, 
+    0x55, 0x15, 0xa9, 0x5a, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 
+    0xa9, 0x5a, 0x55, 0x15, 0x55, 0x55, 0xa9, 0x6a, 0x69, 0x55, 0xa9, 0x1a, 
+    0x69, 0x15, 0x69, 0x55, 0xa9, 0x6a, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x6a, 
+    0x69, 0x55, 0xa9, 0x1a, 0x69, 0x15, 0x69, 0x00, 0x69, 0x00, 0x55, 0x00, 
+    0x54, 0x15, 0xa5, 0x5a, 0x69, 0x69, 0x69, 0x55, 0x69, 0x6a, 0x69, 0x69, 
+    0xa5, 0x6a, 0x54, 0x55, 0x55, 0x55, 0x69, 0x69, 0x69, 0x69, 0xa9, 0x6a, 
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x55, 0x55, 0x50, 0x05, 0x90, 0x06, 
+    0x90, 0x06, 0x90, 0x06, 0x90, 0x06, 0x90, 0x06, 0x90, 0x06, 0x50, 0x05, 
+    0x00, 0x55, 0x00, 0x69, 0x00, 0x69, 0x00, 0x69, 0x55, 0x69, 0x69, 0x69, 
+    0xa5, 0x5a, 0x54, 0x15, 0x55, 0x55, 0x69, 0x69, 0x69, 0x5a, 0xa9, 0x16, 
+    0xa9, 0x16, 0x69, 0x5a, 0x69, 0x69, 0x55, 0x55, 0x55, 0x00, 0x69, 0x00, 
+    0x69, 0x00, 0x69, 0x00, 0x69, 0x00, 0x69, 0x55, 0xa9, 0x6a, 0x55, 0x55, 
+    0x15, 0x55, 0x59, 0x69, 0x69, 0x6a, 0xa9, 0x6a, 0x99, 0x69, 0x59, 0x69, 
+    0x19, 0x69, 0x15, 0x55, 0x55, 0x54, 0x69, 0x65, 0xa9, 0x65, 0xa9, 0x66, 
+    0x69, 0x6a, 0x69, 0x69, 0x69, 0x65, 0x55, 0x54, 0x54, 0x15, 0xa5, 0x5a, 
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0xa5, 0x5a, 0x54, 0x15, 
+    0x55, 0x15, 0xa9, 0x5a, 0x69, 0x69, 0x69, 0x69, 0xa9, 0x5a, 0x69, 0x15, 
+    0x69, 0x00, 0x55, 0x00, 0x54, 0x05, 0xa5, 0x16, 0x69, 0x19, 0xa9, 0x19, 
+    0x69, 0x1a, 0x69, 0x59, 0xa5, 0x66, 0x54, 0x55, 0x55, 0x15, 0xa9, 0x5a, 
+    0x69, 0x69, 0x69, 0x69, 0xa9, 0x5a, 0x69, 0x69, 0x69, 0x69, 0x55, 0x55, 
+    0x54, 0x15, 0xa5, 0x1a, 0x69, 0x15, 0xa9, 0x5a, 0xa5, 0x6a, 0x55, 0x69, 
+    0xa9, 0x5a, 0x55, 0x15, 0x55, 0x55, 0xa9, 0x6a, 0x95, 0x56, 0x90, 0x06, 
+    0x90, 0x06, 0x90, 0x06, 0x90, 0x06, 0x50, 0x05, 0x55, 0x55, 0x69, 0x69, 
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0xa5, 0x5a, 0x54, 0x15, 
+    0x55, 0x55, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x65, 0x59, 0xa4, 0x1a, 
+    0x94, 0x16, 0x50, 0x05, 0x55, 0x55, 0x69, 0x66, 0x69, 0x66, 0x69, 0x66, 
+    0x69, 0x66, 0xa9, 0x6a, 0xa5, 0x59, 0x54, 0x15, 0x55, 0x54, 0x69, 0x65, 
+    0xa5, 0x69, 0x94, 0x5a, 0x94, 0x16, 0xa5, 0x5a, 0x69, 0x69, 0x55, 0x55, 
+    0x55, 0x55, 0x69, 0x69, 0x69, 0x69, 0xa5, 0x5a, 0x94, 0x16, 0x90, 0x06, 
+    0x90, 0x06, 0x50, 0x05, 0x55, 0x55, 0xa9, 0x6a, 0x55, 0x5a, 0x94, 0x16, 
+    0xa5, 0x05, 0x69, 0x55, 0xa9, 0x6a, 0x55, 0x55, 0x50, 0x05, 0x90, 0x06, 
+    0x90, 0x05, 0x90, 0x01, 0x90, 0x01, 0x90, 0x05, 0x90, 0x06, 0x50, 0x05, 
+    0x54, 0x00, 0x64, 0x00, 0x94, 0x01, 0x90, 0x01, 0x50, 0x06, 0x40, 0x06, 
+    0x40, 0x19, 0x00, 0x15, 0x50, 0x05, 0x90, 0x06, 0x50, 0x06, 0x40, 0x06, 
+    0x40, 0x06, 0x50, 0x06, 0x90, 0x06, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 
+    0xa9, 0x6a, 0x55, 0x55, 0x54, 0x00, 0x65, 0x00, 0x59, 0x00, 0x69, 0x00, 
+    0x69, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x15, 
+    0xa5, 0x1a, 0x69, 0x1a, 0x69, 0x1a, 0x69, 0x5a, 0xa5, 0x6a, 0x54, 0x55, 
+    0x55, 0x00, 0x69, 0x00, 0x69, 0x15, 0xa9, 0x5a, 0x69, 0x69, 0x69, 0x69, 
+    0xa9, 0x5a, 0x55, 0x15, 0x00, 0x00, 0x54, 0x15, 0xa5, 0x5a, 0x69, 0x69, 
+    0x69, 0x55, 0x69, 0x69, 0xa5, 0x5a, 0x54, 0x15, 0x00, 0x55, 0x00, 0x69, 
+    0x54, 0x69, 0xa5, 0x6a, 0x69, 0x69, 0x69, 0x69, 0xa5, 0x6a, 0x54, 0x55, 
+    0x00, 0x00, 0x54, 0x15, 0xa5, 0x5a, 0x69, 0x69, 0xa9, 0x6a, 0x69, 0x55, 
+    0xa5, 0x1a, 0x54, 0x15, 0x50, 0x15, 0x94, 0x5a, 0xa4, 0x69, 0xa5, 0x55, 
+    0xa9, 0x1a, 0xa5, 0x15, 0xa4, 0x01, 0x54, 0x01, 0x00, 0x00, 0x54, 0x15, 
+    0xa5, 0x5a, 0x69, 0x69, 0xa5, 0x6a, 0x54, 0x69, 0xa4, 0x5a, 0x54, 0x15, 
+    0x55, 0x00, 0x69, 0x00, 0x69, 0x15, 0xa9, 0x5a, 0x69, 0x69, 0x69, 0x69, 
+    0x69, 0x69, 0x55, 0x55, 0x50, 0x05, 0x90, 0x06, 0x50, 0x05, 0x90, 0x06, 
+    0x90, 0x06, 0x90, 0x06, 0x90, 0x06, 0x50, 0x05, 0x00, 0x55, 0x00, 0x69, 
+    0x00, 0x55, 0x00, 0x69, 0x55, 0x69, 0x69, 0x69, 0xa5, 0x5a, 0x54, 0x15, 
+    0x55, 0x00, 0x69, 0x55, 0x69, 0x69, 0x69, 0x5a, 0xa9, 0x16, 0xa9, 0x5a, 
+    0x69, 0x6a, 0x55, 0x55, 0x54, 0x05, 0xa4, 0x06, 0x94, 0x06, 0x90, 0x06, 
+    0x90, 0x06, 0x90, 0x06, 0x90, 0x06, 0x50, 0x05, 0x00, 0x00, 0x55, 0x15, 
+    0x99, 0x59, 0xa9, 0x6a, 0x99, 0x69, 0x99, 0x69, 0x99, 0x69, 0x55, 0x55, 
+    0x00, 0x00, 0x55, 0x15, 0xa9, 0x5a, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 
+    0x69, 0x69, 0x55, 0x55, 0x00, 0x00, 0x54, 0x15, 0xa5, 0x5a, 0x69, 0x69, 
+    0x69, 0x69, 0x69, 0x69, 0xa5, 0x5a, 0x54, 0x15, 0x00, 0x00, 0x55, 0x15, 
+    0xa9, 0x5a, 0x69, 0x69, 0xa9, 0x5a, 0x69, 0x15, 0x69, 0x00, 0x55, 0x00, 
+    0x00, 0x00, 0x54, 0x55, 0xa5, 0x6a, 0x69, 0x69, 0xa5, 0x6a, 0x54, 0x69, 
+    0x00, 0x69, 0x00, 0x55, 0x00, 0x00, 0x55, 0x55, 0x69, 0x6a, 0xa9, 0x56, 
+    0xa9, 0x05, 0x69, 0x01, 0x69, 0x00, 0x55, 0x00, 0x00, 0x00, 0x54, 0x15, 
+    0xa5, 0x1a, 0x69, 0x15, 0xa5, 0x5a, 0x55, 0x69, 0xa9, 0x5a, 0x55, 0x15, 
+    0x00, 0x00, 0x50, 0x05, 0x95, 0x56, 0xa9, 0x6a, 0x95, 0x56, 0x90, 0x06, 
+    0x90, 0x06, 0x50, 0x05, 0x00, 0x00, 0x55, 0x55, 0x69, 0x69, 0x69, 0x69, 
+    0x69, 0x69, 0x69, 0x69, 0xa5, 0x6a, 0x54, 0x55, 0x00, 0x00, 0x55, 0x55, 
+    0x69, 0x69, 0x69, 0x69, 0x65, 0x59, 0xa4, 0x1a, 0x94, 0x16, 0x50, 0x05, 
+    0x00, 0x00, 0x55, 0x55, 0x69, 0x66, 0x69, 0x66, 0x69, 0x66, 0xa9, 0x6a, 
+    0xa5, 0x59, 0x54, 0x15, 0x00, 0x00, 0x55, 0x55, 0xa9, 0x69, 0xa5, 0x5a, 
+    0x94, 0x16, 0xa5, 0x5a, 0xa9, 0x69, 0x55, 0x55, 0x00, 0x00, 0x55, 0x55, 
+    0x69, 0x69, 0x69, 0x69, 0xa5, 0x6a, 0x95, 0x5a, 0xa9, 0x16, 0x55, 0x05, 
+    0x00, 0x00, 0x55, 0x55, 0xa9, 0x6a, 0x55, 0x5a, 0x94, 0x16, 0xa5, 0x55, 
+    0xa9, 0x6a, 0x55, 0x55, 0x40, 0x05, 0x50, 0x06, 0x90, 0x05, 0x94, 0x01, 
+    0xa4, 0x01, 0x94, 0x05, 0x50, 0x06, 0x40, 0x05, 0x40, 0x05, 0x40, 0x06, 
+    0x40, 0x06, 0x40, 0x06, 0x40, 0x06, 0x40, 0x06, 0x40, 0x06, 0x40, 0x05, 
+    0x50, 0x01, 0x90, 0x05, 0x50, 0x06, 0x40, 0x16, 0x40, 0x1a, 0x50, 0x16, 
+    0x90, 0x05, 0x50, 0x01, 0x54, 0x01, 0xa4, 0x01, 0xa4, 0x01, 0x94, 0x01, 
+    0x64, 0x01, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55
+};
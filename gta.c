@@ -1,11 +1,13 @@
 /* including all tile maps and backgrounds */
-#include "gta_map.h"
-#include "background.h"
-#include "cars.h"
-#include "text.h"
+#include "gta_world.h"
+#include "assets.h"
+#include "luts.h"
+#include "font.h"
+#include "sounds.h"
+#include "vram.h"
 
 #include <stdio.h>
-#include <stdlib.h>
+#include <stddef.h>
 
 #define SCREEN_WIDTH 240
 #define SCREEN_HEIGHT 160
@@ -22,36 +24,47 @@
 #define SPRITE_MAP_2D 0x0
 #define SPRITE_MAP_1D 0x40
 #define SPRITE_ENABLE 0x1000
+#define HBLANK_OAM_ACCESS 0x20
 #define NUM_SPRITES 128
 
-/* setting background control registers */
-volatile unsigned short* bg0_control = (volatile unsigned short*) 0x4000008;
-volatile unsigned short* bg1_control = (volatile unsigned short*) 0x400000a;
-volatile unsigned short* bg2_control = (volatile unsigned short*) 0x400000c;
-volatile unsigned short* bg3_control = (volatile unsigned short*) 0x400000e;
+/* more sprites than oam slots can exist, the multiplexer shares the slots between them */
+#define NUM_OBJECTS 256
+
+/* placing time critical code in internal work ram as arm code */
+#define IWRAM_CODE __attribute__((section(".iwram"), long_call, target("arm")))
+
+/* placing large zeroed buffers in external work ram */
+#define EWRAM_BSS __attribute__((section(".sbss")))
+
+/* the registers are const pointers, so the compiler sees their addresses and can reach
+ * neighbouring ones from one base, and the blocks of them are laid over with structs */
+
+/* setting background control registers, one for each background */
+volatile unsigned short* const bg_control = (volatile unsigned short*) 0x4000008;
 
 #define PALETTE_SIZE 256
 
 /* setting up display control, palette, and button registers */
-volatile unsigned long* display_control = (volatile unsigned long*) 0x4000000;
-volatile unsigned short* bg_palette = (volatile unsigned short*) 0x5000000;
-volatile unsigned short* bgtext_palette = (volatile unsigned short*) 0x5000000;
-volatile unsigned short* buttons = (volatile unsigned short*) 0x04000130;
-
-/* making variables so the backgrounds can scroll */
-volatile short* bg0_x_scroll = (unsigned short*) 0x4000010;
-volatile short* bg0_y_scroll = (unsigned short*) 0x4000012;
-volatile short* bg1_x_scroll = (unsigned short*) 0x4000014;
-volatile short* bg1_y_scroll = (unsigned short*) 0x4000016;
-volatile short* bg2_x_scroll = (unsigned short*) 0x4000018;
-volatile short* bg2_y_scroll = (unsigned short*) 0x400001a;
-volatile short* bg3_x_scroll = (unsigned short*) 0x400001c;
-volatile short* bg3_y_scroll = (unsigned short*) 0x400001e;
-
-/* variables for sprite memory and palette */
-volatile unsigned short* sprite_attribute_memory = (volatile unsigned short*) 0x7000000;
-volatile unsigned short* sprite_image_memory = (volatile unsigned short*) 0x6010000;
-volatile unsigned short* sprite_palette = (volatile unsigned short*) 0x5000200;
+volatile unsigned long* const display_control = (volatile unsigned long*) 0x4000000;
+volatile unsigned short* const bg_palette = (volatile unsigned short*) 0x5000000;
+volatile unsigned short* const bgtext_palette = (volatile unsigned short*) 0x5000000;
+volatile unsigned short* const buttons = (volatile unsigned short*) 0x04000130;
+
+/* making variables so the backgrounds can scroll, the x and y of each are side by side */
+struct BackgroundOffset {
+    short x;
+    short y;
+};
+volatile struct BackgroundOffset* const bg_offset = (volatile struct BackgroundOffset*) 0x4000010;
+
+/* function to scroll a background, writing x and y with one 32 bit store */
+void bg_scroll(int bg, int x, int y) {
+    ((volatile unsigned int*) bg_offset)[bg] = (x & 0xffff) | ((unsigned int) y << 16);
+}
+
+/* variables for sprite memory and palette, oam is laid over with struct Sprite further down */
+volatile unsigned short* const sprite_image_memory = (volatile unsigned short*) 0x6010000;
+volatile unsigned short* const sprite_palette = (volatile unsigned short*) 0x5000200;
 
 /* defining buttons */
 #define BUTTON_A (1 << 0)
@@ -64,29 +77,410 @@ volatile unsigned short* sprite_palette = (volatile unsigned short*) 0x5000200;
 #define BUTTON_DOWN (1 << 7)
 #define BUTTON_R (1 << 8)
 #define BUTTON_L (1 << 9)
+#define BUTTON_ALL 0x3ff
 
-volatile unsigned short* scanline_counter = (volatile unsigned short*) 0x4000006;
+/* keypad control register, which can raise an interrupt when buttons are pressed */
+volatile unsigned short* const button_control = (volatile unsigned short*) 0x4000132;
+#define BUTTON_INT_ENABLE (1 << 14)
+#define BUTTON_INT_ALL_KEYS (1 << 15)
+
+volatile unsigned short* const scanline_counter = (volatile unsigned short*) 0x4000006;
 
 /* defining dma */
 #define DMA_ENABLE 0x80000000
 #define DMA_16 0x00000000
 #define DMA_32 0x04000000
+#define DMA_REPEAT 0x02000000
+#define DMA_DEST_RELOAD 0x00600000
+#define DMA_HBLANK 0x20000000
+
+/* the four dma channels, the count and control halfwords are written together as one word
+ * channel 0 rewrites registers every hblank, 1 and 2 feed the sound, and 3 does copies */
+struct DmaChannel {
+    unsigned int source;
+    unsigned int destination;
+    unsigned int count;
+};
+volatile struct DmaChannel* const dma = (volatile struct DmaChannel*) 0x40000B0;
+#define DMA_HBLANK_AFFINE 0
+#define DMA_COPY 3
+
+/* function to start a dma transfer, count holds the control bits as well */
+void dma_start(int channel, const volatile void* dest, const volatile void* source, unsigned int count) {
+    dma[channel].source = (unsigned int) source;
+    dma[channel].destination = (unsigned int) dest;
+    dma[channel].count = count;
+}
 
-/* dma source, destination, and count variables */
-volatile unsigned int* dma_source = (volatile unsigned int*) 0x40000D4;
-volatile unsigned int* dma_destination = (volatile unsigned int*) 0x40000D8;
-volatile unsigned int* dma_count = (volatile unsigned int*) 0x40000DC;
+/* bytes moved by dma since the start of the frame, for the telemetry */
+unsigned int dma_bytes = 0;
 
 /* function to keep track of dma data */
 void memcpy16_dma(unsigned short* dest, unsigned short* source, int amount) {
-    *dma_source = (unsigned int) source;
-    *dma_destination = (unsigned int) dest;
-    *dma_count = amount | DMA_16 | DMA_ENABLE;
+    dma_bytes += amount * 2;
+    dma_start(DMA_COPY, dest, source, amount | DMA_16 | DMA_ENABLE);
+}
+
+/* interrupt registers and the address the bios jumps through on an interrupt */
+volatile unsigned short* const display_status = (volatile unsigned short*) 0x4000004;
+volatile unsigned short* const interrupt_enable = (volatile unsigned short*) 0x4000200;
+volatile unsigned short* const interrupt_flags = (volatile unsigned short*) 0x4000202;
+volatile unsigned short* const interrupt_master = (volatile unsigned short*) 0x4000208;
+volatile unsigned short* const bios_interrupt_flags = (volatile unsigned short*) 0x3007ff8;
+volatile unsigned int* const interrupt_vector = (volatile unsigned int*) 0x3007ffc;
+
+/* defining interrupts */
+#define INT_VBLANK 0
+#define INT_HBLANK 1
+#define INT_VCOUNT 2
+#define INT_TIMER0 3
+#define INT_TIMER1 4
+#define INT_TIMER2 5
+#define INT_TIMER3 6
+#define INT_SERIAL 7
+#define INT_DMA0 8
+#define INT_DMA1 9
+#define INT_DMA2 10
+#define INT_DMA3 11
+#define INT_KEYPAD 12
+#define INT_GAMEPAK 13
+#define NUM_INTERRUPTS 14
+
+/* display status bits that let the display raise interrupts */
+#define STATUS_VBLANK_INT (1 << 3)
+#define STATUS_HBLANK_INT (1 << 4)
+#define STATUS_VCOUNT_INT (1 << 5)
+
+/* handlers for each interrupt, called from the interrupt dispatcher in interrupt.s
+ * lower interrupt numbers are dispatched first, so vblank has the highest priority */
+typedef void (*InterruptHandler)();
+InterruptHandler interrupt_handlers[NUM_INTERRUPTS];
+
+/* the interrupts each handler lets interrupt it, none unless set by interrupt_set_nesting */
+unsigned short interrupt_masks[NUM_INTERRUPTS];
+
+/* what the dispatcher counts for each interrupt, the layout is relied on by interrupt.s
+ * times are in cycles, and the latency is from entering the dispatcher to the handler starting */
+struct InterruptStats {
+    unsigned int count;
+    unsigned int cycles;
+    unsigned int max_cycles;
+    unsigned int max_latency;
+};
+struct InterruptStats interrupt_stats[NUM_INTERRUPTS];
+
+/* the assembly dispatcher the bios calls on every interrupt */
+void interrupt_dispatch() __attribute__((long_call));
+
+/* function to install the interrupt dispatcher
+ * vblank is always enabled, even without a handler, so the bios can wait for it */
+void interrupt_init() {
+    *interrupt_master = 0;
+    *interrupt_vector = (unsigned int) interrupt_dispatch;
+    *display_status |= STATUS_VBLANK_INT;
+    *interrupt_enable |= (1 << INT_VBLANK);
+    *interrupt_master = 1;
+}
+
+/* function to set the handler for an interrupt and enable it */
+void interrupt_set(int interrupt, InterruptHandler handler) {
+    *interrupt_master = 0;
+    interrupt_handlers[interrupt] = handler;
+    *interrupt_enable |= (1 << interrupt);
+    *interrupt_master = 1;
+}
+
+/* function to let the interrupts in mask interrupt a long handler, 0 turns nesting off
+ * only interrupts that are more urgent than the handler's own should be in the mask */
+void interrupt_set_nesting(int interrupt, unsigned short mask) {
+    *interrupt_master = 0;
+    interrupt_masks[interrupt] = mask & ~(1 << interrupt);
+    *interrupt_master = 1;
+}
+
+/* function to add up the interrupts and the cycles spent in their handlers */
+void interrupt_totals(unsigned int* count, unsigned int* cycles) {
+    *count = 0;
+    *cycles = 0;
+    for (int i = 0; i < NUM_INTERRUPTS; i++) {
+        *count += interrupt_stats[i].count;
+        *cycles += interrupt_stats[i].cycles;
+    }
+}
+
+/* function to keep track of 32 bit dma data */
+void memcpy32_dma(void* dest, const void* source, int amount) {
+    dma_bytes += amount * 4;
+    dma_start(DMA_COPY, dest, source, amount | DMA_32 | DMA_ENABLE);
+}
+
+/* assembly routines for copying and filling memory, counts are in words or halfwords */
+void memcpy32(void* dest, const void* source, int amount) __attribute__((long_call));
+void memset32(void* dest, unsigned int value, int amount) __attribute__((long_call));
+void memcpy16(void* dest, const void* source, int amount) __attribute__((long_call));
+void memset16(void* dest, unsigned short value, int amount) __attribute__((long_call));
+
+/* the four timers, timer 0 paces the sound and timers 2 and 3 are chained into a free running
+ * 32 bit cycle counter, the data is the count when read and the reload value when written */
+struct Timer {
+    unsigned short data;
+    unsigned short control;
+};
+volatile struct Timer* const timer = (volatile struct Timer*) 0x4000100;
+
+/* defining timer control bits */
+#define TIMER_FREQ_1 0x0
+#define TIMER_FREQ_64 0x1
+#define TIMER_FREQ_256 0x2
+#define TIMER_FREQ_1024 0x3
+#define TIMER_CASCADE 0x4
+#define TIMER_INTERRUPT 0x40
+#define TIMER_ENABLE 0x80
+
+/* cycles in one frame of 228 scanlines */
+#define FRAME_CYCLES 280896
+
+/* function to stop a timer and start it again counting up from reload, writing the reload
+ * and the control with one 32 bit store */
+void timer_start(int number, unsigned short reload, unsigned short control) {
+    volatile unsigned int* registers = (volatile unsigned int*) &timer[number];
+    *registers = 0;
+    *registers = reload | (control << 16);
+}
+
+/* function to start the cycle counter */
+void timer_init() {
+    timer[2].control = 0;
+    timer_start(3, 0, TIMER_CASCADE | TIMER_ENABLE);
+    timer_start(2, 0, TIMER_FREQ_1 | TIMER_ENABLE);
+}
+
+/* function to read the cycle counter, reading the high half again if the low half wrapped */
+unsigned int cycles() {
+    unsigned int high = timer[3].data;
+    unsigned int low = timer[2].data;
+    unsigned int check = timer[3].data;
+    if (check != high) {
+        low = timer[2].data;
+    }
+    return (check << 16) | low;
+}
+
+/* one frame of telemetry, written to sram as is so the host tool can read it back */
+struct TelemetryFrame {
+    /* cycles spent before waiting for vblank */
+    unsigned int cycles;
+    /* bytes moved by dma, stopping at 65535 */
+    unsigned short dma_bytes;
+    /* vblanks the frame took, anything over 1 is an overrun */
+    unsigned char vblanks;
+    /* cars in play, stopping at 255 */
+    unsigned char entities;
+    /* cycles spent in interrupt handlers, stopping at 65535 */
+    unsigned short interrupt_cycles;
+    /* interrupts handled, stopping at 65535 */
+    unsigned short interrupts;
+};
+
+/* the last 2048 frames are kept, about 34 seconds, 24k of the 32k of sram */
+#define TELEMETRY_FRAMES 2048
+struct TelemetryFrame telemetry_frames[TELEMETRY_FRAMES] EWRAM_BSS;
+int telemetry_head = 0;
+int telemetry_count = 0;
+
+/* frames since boot, and the frame being measured */
+unsigned int frame_count = 0;
+unsigned int telemetry_start = 0;
+unsigned int telemetry_work = 0;
+int telemetry_running = 0;
+
+/* the interrupt totals at the start of the frame being measured */
+unsigned int telemetry_interrupts = 0;
+unsigned int telemetry_interrupt_cycles = 0;
+
+/* cartridge sram, which only takes byte reads and writes */
+volatile unsigned char* const sram = (volatile unsigned char*) 0xE000000;
+#define SRAM_SIZE 0x8000
+
+/* lets emulators and flashers know the cartridge has sram */
+const char sram_tag[] __attribute__((used, aligned(4))) = "SRAM_V113";
+
+/* the header written before the frames */
+#define TELEMETRY_MAGIC 0x54415447
+#define TELEMETRY_VERSION 2
+
+/* function to record the frame just finished and start timing the next, called once a loop */
+void telemetry_frame(int entities) {
+    unsigned int now = cycles();
+    unsigned int interrupts, interrupt_cycles;
+    interrupt_totals(&interrupts, &interrupt_cycles);
+
+    if (telemetry_running) {
+        struct TelemetryFrame* frame = &telemetry_frames[telemetry_head];
+        unsigned int vblanks = (now - telemetry_start + FRAME_CYCLES / 2) / FRAME_CYCLES;
+        unsigned int handled = interrupts - telemetry_interrupts;
+        unsigned int handler_cycles = interrupt_cycles - telemetry_interrupt_cycles;
+
+        frame->cycles = telemetry_work;
+        frame->dma_bytes = dma_bytes > 0xffff ? 0xffff : dma_bytes;
+        frame->vblanks = vblanks > 0xff ? 0xff : vblanks;
+        frame->entities = entities > 0xff ? 0xff : entities;
+        frame->interrupt_cycles = handler_cycles > 0xffff ? 0xffff : handler_cycles;
+        frame->interrupts = handled > 0xffff ? 0xffff : handled;
+
+        telemetry_head = (telemetry_head + 1) % TELEMETRY_FRAMES;
+        if (telemetry_count < TELEMETRY_FRAMES) {
+            telemetry_count++;
+        }
+    }
+
+    frame_count++;
+    telemetry_running = 1;
+    telemetry_start = now;
+    telemetry_interrupts = interrupts;
+    telemetry_interrupt_cycles = interrupt_cycles;
+    dma_bytes = 0;
+}
+
+/* function to mark the end of the frame's work, just before waiting for vblank */
+void telemetry_work_done() {
+    telemetry_work = cycles() - telemetry_start;
+}
+
+/* function to leave the current frame out, for when the game stops for a while */
+void telemetry_skip() {
+    telemetry_running = 0;
+}
+
+/* function to write a little endian value to sram a byte at a time */
+int sram_write(int offset, unsigned int value, int bytes) {
+    for (int i = 0; i < bytes; i++) {
+        sram[offset++] = value >> (i * 8);
+    }
+    return offset;
+}
+
+/* function to write the telemetry to sram, the interrupt stats and then the frames, oldest first */
+void telemetry_save() {
+    int offset = 0;
+    offset = sram_write(offset, TELEMETRY_MAGIC, 4);
+    offset = sram_write(offset, TELEMETRY_VERSION, 2);
+    offset = sram_write(offset, sizeof(struct TelemetryFrame), 2);
+    offset = sram_write(offset, telemetry_count, 4);
+    offset = sram_write(offset, frame_count, 4);
+    offset = sram_write(offset, FRAME_CYCLES, 4);
+    offset = sram_write(offset, NUM_INTERRUPTS, 4);
+
+    for (int i = 0; i < NUM_INTERRUPTS; i++) {
+        offset = sram_write(offset, interrupt_stats[i].count, 4);
+        offset = sram_write(offset, interrupt_stats[i].cycles, 4);
+        offset = sram_write(offset, interrupt_stats[i].max_cycles, 4);
+        offset = sram_write(offset, interrupt_stats[i].max_latency, 4);
+    }
+
+    int index = (telemetry_head - telemetry_count + TELEMETRY_FRAMES) % TELEMETRY_FRAMES;
+    for (int i = 0; i < telemetry_count && offset + (int) sizeof(struct TelemetryFrame) <= SRAM_SIZE; i++) {
+        struct TelemetryFrame* frame = &telemetry_frames[index];
+        offset = sram_write(offset, frame->cycles, 4);
+        offset = sram_write(offset, frame->dma_bytes, 2);
+        offset = sram_write(offset, frame->vblanks, 1);
+        offset = sram_write(offset, frame->entities, 1);
+        offset = sram_write(offset, frame->interrupt_cycles, 2);
+        offset = sram_write(offset, frame->interrupts, 2);
+        index = (index + 1) % TELEMETRY_FRAMES;
+    }
+}
+
+/* calls a bios function, given as two hex digits, which is free to change r0 to r3, the
+ * number being the whole swi in thumb code and the top byte of its comment field in arm code */
+#if defined(__thumb__)
+#define BIOS_CALL(number) asm volatile("swi " #number ::: "r0", "r1", "r2", "r3", "memory")
+#else
+#define BIOS_CALL(number) asm volatile("swi " #number "0000" ::: "r0", "r1", "r2", "r3", "memory")
+#endif
+
+/* function to halt the cpu until the start of the next vblank, even when already in one
+ * this relies on the dispatcher passing the vblank interrupt on to the bios */
+void wait_next_vblank() {
+    /* VBlankIntrWait */
+    BIOS_CALL(0x05);
 }
 
-/* function to wait for vblank to update screen */
+/* function to wait for vblank to update screen, halting the cpu in the bios until it starts
+ * rather than polling the scanline, and going on at once when already in it */
 void wait_vblank() {volatile unsigned short* sprite_palette = (volatile unsigned short*) 0x5000200;
-    while (*scanline_counter < 160) { }
+    if (*scanline_counter < 160) {
+        wait_next_vblank();
+    }
+}
+
+/* a fixed size pool of objects, the free ones chained through a halfword inside each object
+ * so acquiring and releasing take constant time and nothing is ever malloc'd */
+struct Pool {
+    unsigned char* items;
+    unsigned short item_size;
+    unsigned short link_offset;
+    unsigned short capacity;
+    unsigned short free_head;
+    /* one past the highest object ever handed out, so loops over the pool can stop there */
+    unsigned short end;
+    /* debug counters: objects in use, the most ever in use, and acquires that found it empty */
+    unsigned short used;
+    unsigned short high_water;
+    unsigned short failures;
+};
+
+/* end of the free list */
+#define POOL_NONE 0xffff
+
+/* function to find the link of a free object */
+unsigned short* pool_link(struct Pool* pool, int index) {
+    return (unsigned short*) (pool->items + index * pool->item_size + pool->link_offset);
+}
+
+/* function to set up a pool over an array, with every object free */
+void pool_init(struct Pool* pool, void* items, int item_size, int capacity, int link_offset) {
+    pool->items = items;
+    pool->item_size = item_size;
+    pool->link_offset = link_offset;
+    pool->capacity = capacity;
+    pool->end = 0;
+    pool->used = 0;
+    pool->high_water = 0;
+    pool->failures = 0;
+
+    /* chain them in order, so objects are handed out from the start of the array */
+    for (int i = 0; i < capacity; i++) {
+        *pool_link(pool, i) = i + 1 < capacity ? i + 1 : POOL_NONE;
+    }
+    pool->free_head = capacity > 0 ? 0 : POOL_NONE;
+}
+
+/* function to take an object from a pool, returning 0 when it is empty */
+void* pool_acquire(struct Pool* pool) {
+    int index = pool->free_head;
+    if (index == POOL_NONE) {
+        pool->failures++;
+        return 0;
+    }
+
+    pool->free_head = *pool_link(pool, index);
+    pool->used++;
+    if (pool->used > pool->high_water) {
+        pool->high_water = pool->used;
+    }
+    if (index >= pool->end) {
+        pool->end = index + 1;
+    }
+    return pool->items + index * pool->item_size;
+}
+
+/* function to give an object back to its pool */
+void pool_release(struct Pool* pool, void* item) {
+    int index = ((unsigned char*) item - pool->items) / pool->item_size;
+    *pool_link(pool, index) = pool->free_head;
+    pool->free_head = index;
+    pool->used--;
 }
 
 /* sprite structure */
@@ -97,9 +491,73 @@ struct Sprite {
     unsigned short attribute3;
 };
 
-/* making sprites */
-struct Sprite sprites[NUM_SPRITES];
-int next_sprite_index = 0;
+/* object attribute memory, laid out as 128 sprites, affine matrices use attribute 3 of 4 in a row */
+volatile struct Sprite* const oam = (volatile struct Sprite*) 0x7000000;
+
+/* making sprites, handed out by a pool that chains the free ones through attribute 3, which
+ * the sprites themselves do not use */
+struct Sprite sprites[NUM_OBJECTS] __attribute__((aligned(4)));
+struct Pool sprite_pool;
+
+/* free sprites and culled ones have the disable bit set without the affine bit, so they are
+ * left out of the sort and never take an oam slot */
+#define SPRITE_DISABLED (1 << 9)
+
+/* sprites are drawn in oam order, so the oam copy is rebuilt sorted each frame */
+struct Sprite oam_buffer[NUM_SPRITES] __attribute__((aligned(4)));
+
+/* the sort keys put sprites partly above the screen (y 192-255) before the ones at the top */
+#define SORT_Y_BIAS 64
+#define SORT_BUCKETS 256
+#define SORT_LAYERS 4
+
+/* arrays used by the radix sort */
+unsigned short sort_buckets[SORT_BUCKETS];
+unsigned char sort_keys[NUM_OBJECTS];
+unsigned short sort_live[NUM_OBJECTS];
+unsigned short sort_temp[NUM_OBJECTS];
+unsigned short sort_order[NUM_OBJECTS];
+
+/* when there are more than 128 sprites the screen is split into bands, and oam slots whose
+ * sprites are finished above a band are rewritten in hblank with sprites starting in it */
+#define MPX_BAND_LINES 16
+#define MPX_BANDS (SCREEN_HEIGHT / MPX_BAND_LINES)
+
+/* a band is written in the hblanks from MPX_WINDOW lines above it to MPX_LEAD lines above it,
+ * since sprites for a line are drawn during the line before it */
+#define MPX_WINDOW 8
+#define MPX_LEAD 2
+#define MPX_WRITES_PER_HBLANK 6
+#define MPX_BAND_CAPACITY (MPX_WRITES_PER_HBLANK * (MPX_WINDOW - MPX_LEAD + 1))
+#define MPX_MAX_REWRITES (MPX_BANDS * MPX_BAND_CAPACITY)
+
+/* cycles the hardware has to draw sprites on each scanline with oam unlocked in hblank */
+#define MPX_LINE_BUDGET 954
+
+/* an oam slot rewrite, done once the scanline counter reaches line */
+struct Rewrite {
+    unsigned char slot;
+    unsigned char line;
+    unsigned short attribute0;
+    unsigned short attribute1;
+    unsigned short attribute2;
+};
+
+/* multiplexer state, the rewrites are stored in the order they are done */
+struct Rewrite mpx_rewrites[MPX_MAX_REWRITES];
+volatile int mpx_rewrite_count = 0;
+volatile int mpx_write_position = 0;
+int mpx_dropped = 0;
+
+/* arrays used to hand out oam slots and to track sprite drawing cost on each scanline */
+unsigned char mpx_free_slots[NUM_SPRITES];
+unsigned char mpx_active_slots[NUM_SPRITES];
+short mpx_slot_bottom[NUM_SPRITES];
+unsigned short mpx_line_cost[SCREEN_HEIGHT];
+
+/* sprite sizes in pixels, indexed by shape * 4 + size */
+const unsigned char sprite_widths[12] = {8, 16, 32, 64, 16, 32, 32, 64, 8, 8, 16, 32};
+const unsigned char sprite_heights[12] = {8, 16, 32, 64, 8, 8, 16, 32, 16, 32, 32, 64};
 
 /* enum for sprite sizes */
 enum SpriteSize {
@@ -117,10 +575,13 @@ enum SpriteSize {
     SIZE_32_64
 };
 
-/* function to initailize sprites */
+/* function to initailize sprites, returning 0 when they are all in use */
 struct Sprite* sprite_init(int x, int y, enum SpriteSize size,
     int horizontal_flip, int vertical_flip, int tile_index, int priority) {
-    int index = next_sprite_index++;
+    struct Sprite* sprite = pool_acquire(&sprite_pool);
+    if (!sprite) {
+        return 0;
+    }
     int size_bits, shape_bits;
     switch (size) {
         case SIZE_8_8:   size_bits = 0; shape_bits = 0; break;
@@ -140,38 +601,335 @@ struct Sprite* sprite_init(int x, int y, enum SpriteSize size,
     int h = horizontal_flip ? 1 : 0;
     int v = vertical_flip ? 1 : 0;
 
-    sprites[index].attribute0 = y |             
+    sprite->attribute0 = y |             
         (0 << 8) |          
         (0 << 10) |         
         (0 << 12) |         
         (1 << 13) |         
         (shape_bits << 14);
 
-    sprites[index].attribute1 = x |             
+    sprite->attribute1 = x |             
         (0 << 9) |         
         (h << 12) |         
         (v << 13) |         
         (size_bits << 14); 
 
-    sprites[index].attribute2 = tile_index |   
+    sprite->attribute2 = tile_index |   
         (priority << 10) | 
         (0 << 12);         
 
-    return &sprites[index];
+    return sprite;
+}
+
+/* function to take a sprite off the screen without freeing it */
+void sprite_hide(struct Sprite* sprite) {
+    sprite->attribute0 = (sprite->attribute0 & ~(3 << 8)) | SPRITE_DISABLED;
+}
+
+/* function to put a hidden sprite that is not affine back on the screen */
+void sprite_show(struct Sprite* sprite) {
+    sprite->attribute0 &= ~(3 << 8);
+}
+
+/* function to give a sprite back, hiding it */
+void sprite_free(struct Sprite* sprite) {
+    sprite->attribute0 = SPRITE_DISABLED;
+    pool_release(&sprite_pool, sprite);
+}
+
+/* there are 32 affine matrices, each kept in attribute 3 of a group of 4 oam entries */
+#define NUM_AFFINE 32
+
+/* angles are rounded to 32 steps, so sprites facing the same way share a matrix */
+#define AFFINE_ANGLE_SHIFT 3
+#define AFFINE_ANGLES (lut_angles >> AFFINE_ANGLE_SHIFT)
+
+/* the matrices used this frame, and which matrix each rounded angle has been given */
+short affine_matrices[NUM_AFFINE][4];
+signed char affine_slots[AFFINE_ANGLES];
+int affine_count = 0;
+int affine_scale = 1 << 8;
+
+/* function to start handing out matrices for a frame, scale is texels per pixel with 8 fractional bits */
+void affine_begin(int scale) {
+    for (int i = 0; i < AFFINE_ANGLES; i++) {
+        affine_slots[i] = -1;
+    }
+    affine_count = 0;
+    affine_scale = scale;
+}
+
+/* function to get the matrix that turns a sprite to an angle, making it if no other sprite uses it,
+ * where the matrix takes screen pixels back to the unturned image */
+int affine_matrix(int angle) {
+    int step = ((angle + (1 << (AFFINE_ANGLE_SHIFT - 1))) >> AFFINE_ANGLE_SHIFT) & (AFFINE_ANGLES - 1);
+    if (affine_slots[step] >= 0) {
+        return affine_slots[step];
+    }
+
+    int rounded = step << AFFINE_ANGLE_SHIFT;
+    int sine = (sin_lut[rounded] * affine_scale) >> lut_sin_shift;
+    int cosine = (sin_lut[(rounded + lut_angles / 4) & (lut_angles - 1)] * affine_scale) >> lut_sin_shift;
+    short* matrix = affine_matrices[affine_count];
+    matrix[0] = cosine;
+    matrix[1] = sine;
+    matrix[2] = -sine;
+    matrix[3] = cosine;
+
+    affine_slots[step] = affine_count;
+    return affine_count++;
+}
+
+/* function to draw a sprite with an affine matrix, at double size so turning does not clip it */
+void sprite_set_affine(struct Sprite* sprite, int matrix) {
+    sprite->attribute0 |= (1 << 8) | (1 << 9);
+    sprite->attribute1 &= ~(0x1f << 9);
+    sprite->attribute1 |= (matrix << 9);
+}
+
+/* function to sort the live sprites by layer and then by y, lowest on the screen first,
+ * using two stable counting sort passes so the cost stays linear in the sprite count,
+ * returning how many sprites are live */
+IWRAM_CODE int sprite_sort(int end) {
+    int i, total, count = 0;
+
+    /* first pass: sort on y, flipped so the sprites nearest the bottom come first */
+    for (i = 0; i < SORT_BUCKETS; i++) {
+        sort_buckets[i] = 0;
+    }
+    for (i = 0; i < end; i++) {
+        if ((sprites[i].attribute0 & (3 << 8)) == SPRITE_DISABLED) {
+            continue;
+        }
+        sort_live[count] = i;
+        sort_keys[count] = 255 - ((sprites[i].attribute0 + SORT_Y_BIAS) & 0xff);
+        sort_buckets[sort_keys[count]]++;
+        count++;
+    }
+    total = 0;
+    for (i = 0; i < SORT_BUCKETS; i++) {
+        int n = sort_buckets[i];
+        sort_buckets[i] = total;
+        total += n;
+    }
+    for (i = 0; i < count; i++) {
+        sort_temp[sort_buckets[sort_keys[i]]++] = sort_live[i];
+    }
+
+    /* second pass: sort on the layer (the priority bits), keeping the y order within each layer */
+    for (i = 0; i < SORT_LAYERS; i++) {
+        sort_buckets[i] = 0;
+    }
+    for (i = 0; i < count; i++) {
+        sort_buckets[(sprites[sort_temp[i]].attribute2 >> 10) & 3]++;
+    }
+    total = 0;
+    for (i = 0; i < SORT_LAYERS; i++) {
+        int n = sort_buckets[i];
+        sort_buckets[i] = total;
+        total += n;
+    }
+    for (i = 0; i < count; i++) {
+        int index = sort_temp[i];
+        sort_order[sort_buckets[(sprites[index].attribute2 >> 10) & 3]++] = index;
+    }
+    return count;
+}
+
+/* function to check a sprite against the per scanline drawing budget, and charge it if it fits */
+int mpx_charge_lines(int top, int bottom, int cost) {
+    if (top < 0) {
+        top = 0;
+    }
+    if (bottom >= SCREEN_HEIGHT) {
+        bottom = SCREEN_HEIGHT - 1;
+    }
+    for (int line = top; line <= bottom; line++) {
+        if (mpx_line_cost[line] + cost > MPX_LINE_BUDGET) {
+            return 0;
+        }
+    }
+    for (int line = top; line <= bottom; line++) {
+        mpx_line_cost[line] += cost;
+    }
+    return 1;
+}
+
+/* function to share the oam slots between more sprites than fit, filling oam_buffer for the
+ * start of the frame and building the list of rewrites for the hblank handler */
+IWRAM_CODE void mpx_build(int count) {
+    int virgin = 0, free_count = 0, active_count = 0, band = 0;
+    int band_writes = 0;
+
+    mpx_rewrite_count = 0;
+    mpx_dropped = 0;
+    for (int i = 0; i < SCREEN_HEIGHT; i++) {
+        mpx_line_cost[i] = 0;
+    }
+
+    /* sort_temp holds the sprites by y from the bottom up, so walk it backwards */
+    for (int i = count - 1; i >= 0; i--) {
+        struct Sprite* sprite = &sprites[sort_temp[i]];
+        int y = sprite->attribute0 & 0xff;
+        int x = sprite->attribute1 & 0x1ff;
+        int shape = (sprite->attribute0 >> 14) * 4 + (sprite->attribute1 >> 14);
+        int width = sprite_widths[shape];
+        int height = sprite_heights[shape];
+        int cost = width;
+
+        /* affine sprites take twice as long, and double size ones cover twice the area */
+        if (sprite->attribute0 & (1 << 8)) {
+            cost = 2 * width + 10;
+            if (sprite->attribute0 & (1 << 9)) {
+                width *= 2;
+                height *= 2;
+                cost *= 2;
+            }
+        }
+
+        /* sprites off the bottom or the sides cost nothing */
+        if (y >= SCREEN_HEIGHT && y < 256 - height) {
+            continue;
+        }
+        if (x >= SCREEN_WIDTH && x <= 512 - width) {
+            continue;
+        }
+        if (y >= SCREEN_HEIGHT) {
+            y -= 256;
+        }
+        int bottom = y + height - 1;
+
+        /* when moving on to a later band, release the slots whose sprites are done above it */
+        int sprite_band = y < 0 ? 0 : y / MPX_BAND_LINES;
+        if (sprite_band != band) {
+            band = sprite_band;
+            band_writes = 0;
+            int release = band * MPX_BAND_LINES - MPX_WINDOW;
+            for (int j = 0; j < active_count; j++) {
+                int slot = mpx_active_slots[j];
+                if (mpx_slot_bottom[slot] < release) {
+                    mpx_free_slots[free_count++] = slot;
+                    mpx_active_slots[j--] = mpx_active_slots[--active_count];
+                }
+            }
+        }
+
+        /* an overloaded band or scanline drops the sprite rather than tearing the others */
+        int slot;
+        if (virgin < NUM_SPRITES) {
+            if (!mpx_charge_lines(y, bottom, cost)) {
+                mpx_dropped++;
+                continue;
+            }
+            slot = virgin++;
+            oam_buffer[slot] = *sprite;
+        } else if (band > 0 && free_count > 0 && band_writes < MPX_BAND_CAPACITY) {
+            if (!mpx_charge_lines(y, bottom, cost)) {
+                mpx_dropped++;
+                continue;
+            }
+            slot = mpx_free_slots[--free_count];
+            struct Rewrite* rewrite = &mpx_rewrites[mpx_rewrite_count++];
+            rewrite->slot = slot;
+            rewrite->line = band * MPX_BAND_LINES - MPX_WINDOW;
+            rewrite->attribute0 = sprite->attribute0;
+            rewrite->attribute1 = sprite->attribute1;
+            rewrite->attribute2 = sprite->attribute2;
+            band_writes++;
+        } else {
+            mpx_dropped++;
+            continue;
+        }
+
+        mpx_slot_bottom[slot] = bottom;
+        mpx_active_slots[active_count++] = slot;
+    }
+
+    for (int i = virgin; i < NUM_SPRITES; i++) {
+        oam_buffer[i].attribute0 = SCREEN_HEIGHT;
+        oam_buffer[i].attribute1 = SCREEN_WIDTH;
+    }
+}
+
+/* hblank handler doing the multiplexer rewrites whose line has been reached */
+IWRAM_CODE void mpx_hblank() {
+    int line = *scanline_counter;
+    int position = mpx_write_position;
+    int end = position + MPX_WRITES_PER_HBLANK;
+
+    /* in vblank the rewritten slots go back to how the frame starts, so the sprites keep
+     * multiplexing when nothing calls sprite_update_all, as while paused */
+    if (line >= SCREEN_HEIGHT) {
+        for (int i = 0; i < position; i++) {
+            struct Sprite* start = &oam_buffer[mpx_rewrites[i].slot];
+            volatile struct Sprite* entry = &oam[mpx_rewrites[i].slot];
+            *(volatile unsigned int*) entry = start->attribute0 | ((unsigned int) start->attribute1 << 16);
+            entry->attribute2 = start->attribute2;
+        }
+        mpx_write_position = 0;
+        return;
+    }
+    if (end > mpx_rewrite_count) {
+        end = mpx_rewrite_count;
+    }
+    while (position < end && mpx_rewrites[position].line <= line) {
+        struct Rewrite* rewrite = &mpx_rewrites[position++];
+        volatile struct Sprite* entry = &oam[rewrite->slot];
+        *(volatile unsigned int*) entry = rewrite->attribute0 | ((unsigned int) rewrite->attribute1 << 16);
+        entry->attribute2 = rewrite->attribute2;
+    }
+    mpx_write_position = position;
+}
+
+/* function to set up the sprite multiplexer */
+void mpx_init() {
+    interrupt_set(INT_HBLANK, mpx_hblank);
 }
 
-/* function used to update sprites */
+/* function used to update sprites, the front most sprite goes in the first oam slot */
 void sprite_update_all() {
-    memcpy16_dma((unsigned short*) sprite_attribute_memory, (unsigned short*) sprites, NUM_SPRITES * 4);
+    int count = sprite_sort(sprite_pool.end);
+
+    if (count <= NUM_SPRITES) {
+        mpx_rewrite_count = 0;
+        for (int i = 0; i < count; i++) {
+            oam_buffer[i] = sprites[sort_order[i]];
+        }
+        for (int i = count; i < NUM_SPRITES; i++) {
+            oam_buffer[i].attribute0 = SCREEN_HEIGHT;
+            oam_buffer[i].attribute1 = SCREEN_WIDTH;
+        }
+    } else {
+        /* too many sprites for oam, so the depth order gives way to sharing the slots */
+        mpx_build(count);
+    }
+
+    /* the matrices go in attribute 3, which the sprites themselves do not use */
+    for (int i = 0; i < affine_count; i++) {
+        for (int j = 0; j < 4; j++) {
+            oam_buffer[i * 4 + j].attribute3 = affine_matrices[i][j];
+        }
+    }
+
+    memcpy32_dma((void*) oam, oam_buffer, NUM_SPRITES * 2);
+
+    /* the hblank interrupt is only needed while there are rewrites to do */
+    mpx_write_position = 0;
+    if (mpx_rewrite_count > 0) {
+        *display_status |= STATUS_HBLANK_INT;
+    } else {
+        *display_status &= ~STATUS_HBLANK_INT;
+    }
 }
 
 /* function used to clear sprite data */
 void sprite_clear() {
-    next_sprite_index = 0;
+    pool_init(&sprite_pool, sprites, sizeof(struct Sprite), NUM_OBJECTS, offsetof(struct Sprite, attribute3));
 
-    for(int i = 0; i < NUM_SPRITES; i++) {
-        sprites[i].attribute0 = SCREEN_HEIGHT;
-        sprites[i].attribute1 = SCREEN_WIDTH;
+    /* attributes 0 and 1 share a word, so each sprite is freed with one store */
+    unsigned int* words = (unsigned int*) sprites;
+    for(int i = 0; i < NUM_OBJECTS; i++) {
+        words[i * 2] = SPRITE_DISABLED | (SCREEN_WIDTH << 16);
     }
 }
 
@@ -198,18 +956,98 @@ void sprite_set_offset(struct Sprite* sprite, int offset) {
 
 /* function to take in sprite image */
 void setup_sprite_image() {
-    memcpy16_dma((unsigned short*) sprite_palette, (unsigned short*) cars_palette, PALETTE_SIZE);
+    memcpy16_dma((unsigned short*) sprite_palette, (unsigned short*) obj_palette_data, obj_palette_size);
 
     memcpy16_dma((unsigned short*) sprite_image_memory, (unsigned short*) cars_data, (cars_width * cars_height) / 2);
 }
 
-/* function checking if a button has been pressed */
+/* number of buttons, and the timings for auto repeat and for buffering presses, in frames */
+#define NUM_BUTTONS 10
+#define REPEAT_DELAY 20
+#define REPEAT_RATE 4
+#define BUFFER_FRAMES 6
+
+/* button state latched once per frame, as bitmasks of the BUTTON_ values */
+unsigned short buttons_held = 0;
+unsigned short buttons_down = 0;
+unsigned short buttons_up = 0;
+unsigned short buttons_repeat = 0;
+
+/* per button frame counters for auto repeat and for buffered presses */
+unsigned char repeat_timers[NUM_BUTTONS];
+unsigned char buffer_timers[NUM_BUTTONS];
+
+/* function to read the buttons once for the frame, the register reads 0 for a held button */
+void input_poll() {
+    unsigned short previous = buttons_held;
+    buttons_held = ~*buttons & BUTTON_ALL;
+    buttons_down = buttons_held & ~previous;
+    buttons_up = previous & ~buttons_held;
+    buttons_repeat = buttons_down;
+
+    for (int i = 0; i < NUM_BUTTONS; i++) {
+        unsigned short button = 1 << i;
+
+        if (buttons_down & button) {
+            repeat_timers[i] = REPEAT_DELAY;
+            buffer_timers[i] = BUFFER_FRAMES;
+        } else if (buttons_held & button) {
+            if (--repeat_timers[i] == 0) {
+                repeat_timers[i] = REPEAT_RATE;
+                buttons_repeat |= button;
+            }
+        }
+
+        if (buffer_timers[i] && !(buttons_down & button)) {
+            buffer_timers[i]--;
+        }
+    }
+}
+
+/* function checking if a button is held down */
+unsigned char button_held(unsigned short button) {
+    return (buttons_held & button) != 0;
+}
+
+/* function checking if a button was pressed this frame */
 unsigned char button_pressed(unsigned short button) {
-    unsigned short pressed = *buttons & button;
-    if (pressed == 0) {
-        return 1;
-    } else {
-        return 0;
+    return (buttons_down & button) != 0;
+}
+
+/* function checking if a button was let go this frame */
+unsigned char button_released(unsigned short button) {
+    return (buttons_up & button) != 0;
+}
+
+/* function checking if a button was pressed or is auto repeating this frame */
+unsigned char button_repeated(unsigned short button) {
+    return (buttons_repeat & button) != 0;
+}
+
+/* function checking if a button was pressed in the last few frames, using up the press */
+unsigned char button_buffered(unsigned short button) {
+    for (int i = 0; i < NUM_BUTTONS; i++) {
+        if ((button & (1 << i)) && buffer_timers[i]) {
+            buffer_timers[i] = 0;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* keypad interrupt handler, the interrupt keeps firing while the keys are held so it turns itself off */
+void input_wake() {
+    *button_control &= ~BUTTON_INT_ENABLE;
+}
+
+/* function to halt the cpu until one of the buttons is pressed */
+void input_wait(unsigned short button) {
+    interrupt_set(INT_KEYPAD, input_wake);
+    *button_control = button | BUTTON_INT_ENABLE;
+
+    while (*button_control & BUTTON_INT_ENABLE) {
+        /* Halt, woken by any interrupt */
+        BIOS_CALL(0x02);
     }
 }
 
@@ -223,190 +1061,2113 @@ volatile unsigned short* screen_block(unsigned long block) {
     return (volatile unsigned short*) (0x6000000 + (block * 0x800));
 }
 
-/* function to set up the background */
-void setup_background() {
-    memcpy16_dma((unsigned short*) bg_palette, (unsigned short*) background_palette, PALETTE_SIZE);
-    memcpy16_dma((unsigned short*) char_block(0), (unsigned short*) background_data,
-            (background_width * background_height) / 2);
+/* ways of copying memory compared by copy_calibrate */
+#define COPY_LOOP 0
+#define COPY_ASSEMBLY 1
+#define COPY_DMA 2
+#define COPY_METHODS 3
 
-    memcpy16_dma((unsigned short*) char_block(1), (unsigned short*) text_data, (text_width * text_height) / 2);
-    
-    volatile unsigned short* dest = char_block(0);
-    volatile unsigned short* dest1 = char_block(1);
-    
-    unsigned short* image = (unsigned short*) background_data;
-    for (int i = 0; i < ((background_width * background_height) / 2); i++) {
-        dest[i] = image[i];
-    }
+/* copy sizes in words that are timed, each one four times the one before */
+#define COPY_SIZES 5
+const unsigned short copy_sizes[COPY_SIZES] = {4, 16, 64, 256, 1024};
 
-    *bg0_control = 1 |   
-        (0 << 2)  |       
-        (0 << 6)  |       
-        (1 << 7)  |       
-        (16 << 8) |       
-        (1 << 13) |      
-        (0 << 14); 
-    
-    *bg1_control = 0 |
-        (1 << 2) | 
-        (0 << 6) |
-        (1 << 7) | 
-        (24 << 8) | 
-        (1 << 13) | 
-        (0 << 14);
+/* the timings in cycles, and the fastest method for copies of at least each size */
+unsigned int copy_timings[COPY_SIZES][COPY_METHODS];
+unsigned char copy_fastest[COPY_SIZES] = {COPY_ASSEMBLY, COPY_ASSEMBLY, COPY_ASSEMBLY, COPY_DMA, COPY_DMA};
 
-    dest = screen_block(16);
-    for (int i = 0; i < (gta_map_width * gta_map_height); i++) {
-        dest[i] = gta_map[i];
-    }
-    
-    dest1 = screen_block(24);
-    for (int i = 0; i < 32; i++) {
-        dest1[i] = 0;   
+/* function to copy halfwords with the cpu, the way the copies were done before */
+void memcpy16_loop(volatile unsigned short* dest, const unsigned short* source, int amount) {
+    for (int i = 0; i < amount; i++) {
+        dest[i] = source[i];
     }
 }
 
-/* car struct */
-struct Car {
-    struct Sprite* sprite;
-    int x, y;
-    int frame;
-    int counter;
-    float move;
-    int border;
-};
+/* function to time each copy method from rom into vram, it scribbles over char block 2 so
+ * it must run before the backgrounds are set up */
+void copy_calibrate() {
+    void* dest = (void*) char_block(2);
+    const void* source = background_data;
 
-/* initializing car sprite */
-void car_init(struct Car* car, int x, int y, int frame) {
-    car->x = x;
-    car->y = y;
-    car->border = 40;
-    car->frame = frame;
-    car->move = 0;
-    car->sprite = sprite_init(car->x, car->y, SIZE_32_16, 0, 0, car->frame, 0);
-}
+    for (int i = 0; i < COPY_SIZES; i++) {
+        int words = copy_sizes[i];
+        unsigned int start;
 
-/* function to move the police car left */
-int policecar_left(struct Car* car) {
-    car->move = 1;
+        start = cycles();
+        memcpy16_loop(dest, source, words * 2);
+        copy_timings[i][COPY_LOOP] = cycles() - start;
 
-    if (car->x < car->border) {
-        return 1;
-    } else {
-        car->x--;
-        return 0;
+        start = cycles();
+        memcpy32(dest, source, words);
+        copy_timings[i][COPY_ASSEMBLY] = cycles() - start;
+
+        start = cycles();
+        memcpy32_dma(dest, source, words);
+        copy_timings[i][COPY_DMA] = cycles() - start;
+
+        int best = COPY_LOOP;
+        for (int method = 1; method < COPY_METHODS; method++) {
+            if (copy_timings[i][method] < copy_timings[i][best]) {
+                best = method;
+            }
+        }
+        copy_fastest[i] = best;
     }
 }
 
-/* function to move the player's car left */
-int car_left(struct Car* car) {
-    car->move = 1;
+/* function to copy memory with whichever method was fastest for the size, falling back
+ * to halfwords when the addresses or size are not word aligned, the addresses must be at
+ * least halfword aligned */
+void memcpy_fast(void* dest, const void* source, int bytes) {
+    if ((((unsigned int) dest) | ((unsigned int) source) | bytes) & 3) {
+        memcpy16(dest, source, bytes >> 1);
+
+        /* an odd last byte is merged into its halfword, since vram does not take byte writes */
+        if (bytes & 1) {
+            volatile unsigned short* last = (volatile unsigned short*) ((unsigned char*) dest + bytes - 1);
+            *last = (*last & 0xff00) | ((const unsigned char*) source)[bytes - 1];
+        }
+        return;
+    }
 
-    if (car->x < car->border) {
-        return 1;
-    } else {
-        car->x--;
-        return 0;
+    int words = bytes >> 2;
+    int size = 0;
+    while (size < COPY_SIZES - 1 && words >= copy_sizes[size + 1]) {
+        size++;
+    }
+
+    switch (copy_fastest[size]) {
+        case COPY_LOOP: memcpy16_loop(dest, source, words * 2); break;
+        case COPY_ASSEMBLY: memcpy32(dest, source, words); break;
+        case COPY_DMA: memcpy32_dma(dest, source, words); break;
     }
 }
 
-/* function to move the police car right */
-int policecar_right(struct Car* policecar, struct Car* currentcar) {
-    policecar->move = 1;
+/* every run of four packed pixels expanded to the word of 8 bit pixels it stands for, built at boot */
+unsigned int font_expand[1 << (4 * font_bits)];
 
-    if (currentcar->move == 1)
-    {
-        if (policecar->x/2 > SCREEN_WIDTH - 49 - policecar->border) {
-            return 1;
-        }
-        else{
-            policecar->x++;
-            return 0;
+/* the glyph drawn for each character, so characters past ascii can be given tiles too */
+unsigned char font_glyph_index[256];
+
+/* function to draw a character with a glyph, the glyph being a tile in char block 1 */
+void font_map(unsigned char ch, unsigned char glyph) {
+    font_glyph_index[ch] = glyph;
+}
+
+/* function to build the table that expands packed font bits into 8 bit pixels */
+void font_build_expand() {
+    for (int i = 0; i < (1 << (4 * font_bits)); i++) {
+        unsigned int word = 0;
+        for (int p = 0; p < 4; p++) {
+            int code = (i >> (p * font_bits)) & ((1 << font_bits) - 1);
+            word |= font_colors[code] << (p * 8);
         }
+        font_expand[i] = word;
     }
-    else{
-        if (policecar->x/2 > SCREEN_WIDTH - 16 - policecar->border) {
-            return 1;
-        }
-        else{
-            policecar->x++;
-            return 0;
-        }
+}
+
+/* function to unpack the font into char block 1 a word of four pixels at a time */
+IWRAM_CODE void font_unpack(volatile unsigned int* dest) {
+    const unsigned char* src = font_data;
+    const unsigned char* end = font_data + sizeof(font_data);
+    while (src < end) {
+        unsigned int byte = *src++;
+#if font_bits == 1
+        /* a byte holds eight pixels, looked up as two nibbles */
+        *dest++ = font_expand[byte & 0xf];
+        *dest++ = font_expand[byte >> 4];
+#else
+        /* a byte holds four pixels, exactly one word of them */
+        *dest++ = font_expand[byte];
+#endif
     }
 }
 
-/* function to move the player's car right */
-int car_right(struct Car* car) {
-    car->move = 1;
+/* function to load the font and set up the glyph table */
+void font_load() {
+    font_build_expand();
+    font_unpack((volatile unsigned int*) char_block(1));
 
-    if (car->x > (SCREEN_WIDTH - 16 - car->border)) {
-        return 1;
-    } else {
-        car->x++;
-        return 0;
+    /* characters without a glyph show as a question mark */
+    for (int i = 0; i < 256; i++) {
+        font_map(i, '?' - font_first_char);
+    }
+    for (int i = 0; i < font_glyphs; i++) {
+        font_map(font_first_char + i, i);
     }
 }
 
-/* function to move the player's car up */
-int car_up(struct Car* car) {
-   car->move = 1; 
+/* animated tiles keep their map entries, and only their graphics in char block 0 change:
+ * each animation steps through frames of 64 byte 8 bit tiles, and the copies are queued to
+ * be done in vblank, so the cost is per animated tile and not per place it is on the map */
+#define TILE_BYTES 64
+#define MAX_TILE_ANIMATIONS 8
+#define TILE_QUEUE_SIZE MAX_TILE_ANIMATIONS
+
+struct TileAnimation {
+    const unsigned char* frames;
+    unsigned char tile;
+    unsigned char frame_count;
+    unsigned char period;
+    unsigned char timer;
+    unsigned char frame;
+};
 
-    if (car->y < ((car->border) - 15)) {
-        return 1;
-    } else {
-        car->y--;
-        return 0;
-    } 
-}
+struct TileAnimation tile_animations[MAX_TILE_ANIMATIONS];
+int tile_animation_count = 0;
 
-/* function to move the player's car down */
-int car_down(struct Car* car) {
-    car->move = 1;
+/* a tile graphic waiting for vblank */
+struct TileCopy {
+    const unsigned char* source;
+    int tile;
+};
 
-    if (car->y > (SCREEN_HEIGHT - 16 - car->border)) {
-        return 1;
-    } else {
-        car->y++;
+struct TileCopy tile_queue[TILE_QUEUE_SIZE];
+int tile_queue_count = 0;
+
+/* the water tiles are one flat color, so they flow by having ripples of a lighter blue drawn
+ * over them a pixel further to the right each frame, the frames being made at boot */
+#define WATER_TILES 3
+#define WATER_FRAMES 8
+#define WATER_PERIOD 8
+#define WATER_RIPPLE 10
+const unsigned char water_tiles[WATER_TILES] = {0, 10, 11};
+unsigned char water_frames[WATER_TILES][WATER_FRAMES][TILE_BYTES] EWRAM_BSS __attribute__((aligned(4)));
+
+/* function to animate a tile through frames, a frame every period frames, returns 0 when full */
+int tile_animation_add(int tile, const unsigned char* frames, int frame_count, int period) {
+    if (tile_animation_count == MAX_TILE_ANIMATIONS) {
         return 0;
     }
+    struct TileAnimation* animation = &tile_animations[tile_animation_count++];
+    animation->frames = frames;
+    animation->tile = tile;
+    animation->frame_count = frame_count;
+    animation->period = period;
+    animation->timer = period;
+    animation->frame = 0;
+    return 1;
 }
 
-/* function to make the car stop moving */
+/* function to make the water frames and start them */
+void tiles_init() {
+    tile_animation_count = 0;
+    tile_queue_count = 0;
+
+    for (int i = 0; i < WATER_TILES; i++) {
+        const unsigned char* tile = background_data + water_tiles[i] * TILE_BYTES;
+        for (int frame = 0; frame < WATER_FRAMES; frame++) {
+            for (int y = 0; y < 8; y++) {
+                for (int x = 0; x < 8; x++) {
+                    int ripple = (y & 1) == 0 && ((x - frame - y * 3) & 7) < 2;
+                    water_frames[i][frame][y * 8 + x] = ripple ? WATER_RIPPLE : tile[y * 8 + x];
+                }
+            }
+        }
+        tile_animation_add(water_tiles[i], water_frames[i][0], WATER_FRAMES, WATER_PERIOD);
+    }
+}
+
+/* function to step the animations and queue the tiles that changed, called before vblank */
+void tiles_animate() {
+    for (int i = 0; i < tile_animation_count; i++) {
+        struct TileAnimation* animation = &tile_animations[i];
+        if (--animation->timer) {
+            continue;
+        }
+        animation->timer = animation->period;
+        animation->frame = animation->frame + 1 < animation->frame_count ? animation->frame + 1 : 0;
+        if (tile_queue_count < TILE_QUEUE_SIZE) {
+            struct TileCopy* copy = &tile_queue[tile_queue_count++];
+            copy->source = animation->frames + animation->frame * TILE_BYTES;
+            copy->tile = animation->tile;
+        }
+    }
+}
+
+/* function to copy the queued tiles into char block 0, called in vblank */
+void tiles_flush() {
+    for (int i = 0; i < tile_queue_count; i++) {
+        memcpy_fast((void*) (char_block(0) + tile_queue[i].tile * (TILE_BYTES / 2)), tile_queue[i].source, TILE_BYTES);
+    }
+    tile_queue_count = 0;
+}
+
+/* function to set up the background */
+void setup_background() {
+    memcpy_fast((void*) bg_palette, bg_palette_data, bg_palette_size * 2);
+    memcpy_fast((void*) char_block(0), background_data, background_width * background_height);
+    font_load();
+
+    bg_control[0] = 1 |   
+        (0 << 2)  |       
+        (0 << 6)  |       
+        (1 << 7)  |       
+        (16 << 8) |       
+        (1 << 13) |      
+        (3 << 14); 
+    
+    bg_control[1] = 0 |
+        (1 << 2) | 
+        (0 << 6) |
+        (1 << 7) | 
+        (TEXT_SCREEN_BLOCK << 8) | 
+        (1 << 13) | 
+        (0 << 14);
+
+    memset16((void*) screen_block(TEXT_SCREEN_BLOCK), 0, 32);
+    tiles_init();
+}
+
+/* palette effects change a range of palette entries on a timer, without touching any tiles or maps:
+ * rotating moves the colors of the range along by one each step, and pulsing fades every entry
+ * of the range between two colors and back */
+#define PALETTE_ROTATE 0
+#define PALETTE_PULSE 1
+#define MAX_PALETTE_EFFECTS 8
+#define PALETTE_EFFECT_COLORS 8
+
+struct PaletteEffect {
+    volatile unsigned short* palette;
+    unsigned char first;
+    unsigned char count;
+    unsigned char mode;
+    /* frames between rotations, or frames for a whole pulse there and back */
+    unsigned char period;
+    unsigned char timer;
+    unsigned char step;
+    /* the range's own colors for rotating, or the two ends of the pulse */
+    unsigned short colors[PALETTE_EFFECT_COLORS];
+};
+
+struct PaletteEffect palette_effects[MAX_PALETTE_EFFECTS];
+int palette_effect_count = 0;
+
+/* police lights: the red, greys and blue of the light bar only appear on the police car, so
+ * rotating them makes the lights chase round */
+#define SIREN_FIRST 9
+#define SIREN_COUNT 5
+#define SIREN_PERIOD 6
+
+/* the light bar's grey copied into an unused entry past the siren, for the smoke and blips
+ * drawn in it, which would otherwise flash along with the lights */
+#define STEADY_GREY 14
+#define SIREN_GREY 11
+_Static_assert(STEADY_GREY >= SIREN_FIRST + SIREN_COUNT && STEADY_GREY < 16, "the steady grey is in the siren's range");
+
+/* the water color pulses to a lighter blue and back every second */
+#define WATER_COLOR 1
+#define WATER_LIGHT 0x7f0f
+#define WATER_PULSE 60
+
+/* function to start rotating a range of palette entries, returns 0 when there is no room */
+int palette_rotate(volatile unsigned short* palette, int first, int count, int period) {
+    if (palette_effect_count == MAX_PALETTE_EFFECTS || count > PALETTE_EFFECT_COLORS) {
+        return 0;
+    }
+    struct PaletteEffect* effect = &palette_effects[palette_effect_count++];
+    effect->palette = palette;
+    effect->first = first;
+    effect->count = count;
+    effect->mode = PALETTE_ROTATE;
+    effect->period = period;
+    effect->timer = period;
+    effect->step = 0;
+    for (int i = 0; i < count; i++) {
+        effect->colors[i] = palette[first + i];
+    }
+    return 1;
+}
+
+/* function to start pulsing a range of palette entries between two colors, returns 0 when there is no room */
+int palette_pulse(volatile unsigned short* palette, int first, int count, unsigned short from,
+        unsigned short to, int period) {
+    if (palette_effect_count == MAX_PALETTE_EFFECTS) {
+        return 0;
+    }
+    struct PaletteEffect* effect = &palette_effects[palette_effect_count++];
+    effect->palette = palette;
+    effect->first = first;
+    effect->count = count;
+    effect->mode = PALETTE_PULSE;
+    effect->period = period;
+    effect->timer = 0;
+    effect->step = 0;
+    effect->colors[0] = from;
+    effect->colors[1] = to;
+    return 1;
+}
+
+/* function to mix two colors, amount going from 0 for the first to 256 for the second */
+unsigned short color_mix(unsigned short from, unsigned short to, int amount) {
+    int color = 0;
+    for (int shift = 0; shift < 15; shift += 5) {
+        int a = (from >> shift) & 0x1f;
+        int b = (to >> shift) & 0x1f;
+        color |= (a + (((b - a) * amount) >> 8)) << shift;
+    }
+    return color;
+}
+
+/* function to set up the siren and water effects, after the palettes are loaded */
+void palette_effects_init() {
+    palette_effect_count = 0;
+    sprite_palette[STEADY_GREY] = obj_palette_data[SIREN_GREY];
+    palette_rotate(sprite_palette, SIREN_FIRST, SIREN_COUNT, SIREN_PERIOD);
+    palette_pulse(bg_palette, WATER_COLOR, 1, bg_palette_data[WATER_COLOR], WATER_LIGHT, WATER_PULSE);
+}
+
+/* function to step the palette effects, called in vblank: a rotation writes its range once
+ * per step, and a pulse writes its range every frame */
+void palette_effects_update() {
+    for (int i = 0; i < palette_effect_count; i++) {
+        struct PaletteEffect* effect = &palette_effects[i];
+        volatile unsigned short* entry = effect->palette + effect->first;
+
+        if (effect->mode == PALETTE_ROTATE) {
+            if (--effect->timer) {
+                continue;
+            }
+            effect->timer = effect->period;
+            effect->step = effect->step + 1 < effect->count ? effect->step + 1 : 0;
+            int source = effect->step;
+            for (int j = 0; j < effect->count; j++) {
+                entry[j] = effect->colors[source];
+                source = source + 1 < effect->count ? source + 1 : 0;
+            }
+        } else {
+            /* the timer runs over the whole period, going out for the first half and back for the second */
+            effect->timer = effect->timer + 1 < effect->period ? effect->timer + 1 : 0;
+            int half = effect->period / 2;
+            int position = effect->timer < half ? effect->timer : effect->period - effect->timer;
+            unsigned short color = color_mix(effect->colors[0], effect->colors[1], (position << 8) / half);
+            for (int j = 0; j < effect->count; j++) {
+                entry[j] = color;
+            }
+        }
+    }
+}
+
+/* sound registers: direct sound a and b are fed from fifos that dma 1 and 2 keep topped up,
+ * at the rate timer 0 overflows */
+volatile unsigned short* const sound_control = (volatile unsigned short*) 0x4000082;
+volatile unsigned short* const sound_master = (volatile unsigned short*) 0x4000084;
+volatile unsigned int* const fifo_a = (volatile unsigned int*) 0x40000A0;
+volatile unsigned int* const fifo_b = (volatile unsigned int*) 0x40000A4;
+#define DMA_SOUND_A 1
+#define DMA_SOUND_B 2
+#define TIMER_SOUND 0
+
+/* sound control bits: a goes full volume to the left speaker and b to the right, both on timer 0 */
+#define SOUND_A_FULL (1 << 2)
+#define SOUND_B_FULL (1 << 3)
+#define SOUND_A_LEFT (1 << 9)
+#define SOUND_A_RESET (1 << 11)
+#define SOUND_B_RIGHT (1 << 12)
+#define SOUND_B_RESET (1 << 15)
+#define SOUND_ENABLE (1 << 7)
+
+/* dma bits for feeding a fifo */
+#define DMA_DEST_FIXED 0x00400000
+#define DMA_SPECIAL 0x30000000
+#define DMA_FIFO (DMA_DEST_FIXED | DMA_REPEAT | DMA_32 | DMA_SPECIAL | DMA_ENABLE)
+
+/* 304 samples play in exactly one frame, a sample every 924 cycles */
+#define SOUND_SAMPLES 304
+#define SOUND_SAMPLE_CYCLES (FRAME_CYCLES / SOUND_SAMPLES)
+
+/* the dma reads ahead of what the fifo has played, so the output runs on by a fifo's worth of
+ * silence that is thrown away when the fifos are reset */
+#define SOUND_PADDING 32
+
+/* channels are mixed in the assembly in mixer.s, which depends on this layout, positions
+ * are in samples with 12 fractional bits and volumes go from 0 to 32 */
+#define SOUND_CHANNELS 8
+#define SOUND_SHIFT 12
+#define SOUND_VOLUME_MAX 32
+
+struct SoundChannel {
+    const signed char* data;
+    unsigned int position;
+    unsigned int increment;
+    unsigned int length;
+    unsigned int loop_length;
+    int volume_left;
+    int volume_right;
+    int active;
+};
+
+struct SoundChannel sound_channels[SOUND_CHANNELS];
+
+/* the mix for a frame, and two frames of output for each side: dma plays one while the other is mixed */
+int sound_mix_buffer[SOUND_SAMPLES];
+signed char sound_left[2 * SOUND_SAMPLES + SOUND_PADDING] __attribute__((aligned(4)));
+signed char sound_right[2 * SOUND_SAMPLES + SOUND_PADDING] __attribute__((aligned(4)));
+volatile int sound_playing = 0;
+
+/* set by the vblank handler for each frame of output that has finished playing and is waiting
+ * to be mixed, and cleared by sound_mix as it fills it, so each is mixed exactly once however
+ * the main loop's frames line up with the vblanks */
+volatile unsigned char sound_free[2];
+
+/* the cycles the last mix took */
+unsigned int sound_mix_cycles = 0;
+
+/* assembly routines for mixing */
+void sound_mix_channel(struct SoundChannel* channel, int* mix, int count) __attribute__((long_call));
+void sound_mix_output(int* mix, signed char* left, signed char* right, int count) __attribute__((long_call));
+
+/* function to point the fifo dmas at the start of the output, emptying the fifos of what the
+ * dmas read ahead so the first frame's samples are the next to play */
+IWRAM_CODE void sound_restart() {
+    dma[DMA_SOUND_A].count = 0;
+    dma[DMA_SOUND_B].count = 0;
+    *sound_control |= SOUND_A_RESET | SOUND_B_RESET;
+    dma[DMA_SOUND_A].source = (unsigned int) sound_left;
+    dma[DMA_SOUND_B].source = (unsigned int) sound_right;
+    dma[DMA_SOUND_A].count = DMA_FIFO;
+    dma[DMA_SOUND_B].count = DMA_FIFO;
+}
+
+/* vblank handler: the dma has just finished a frame of output, which is now free to mix into,
+ * and once it has played the second frame it goes back to the first, the first vblank after
+ * sound_init starting the output so its frames line up with the screen's */
+IWRAM_CODE void sound_vblank() {
+    if (!(timer[TIMER_SOUND].control & TIMER_ENABLE)) {
+        sound_restart();
+        timer[TIMER_SOUND].data = 65536 - SOUND_SAMPLE_CYCLES;
+        timer[TIMER_SOUND].control = TIMER_FREQ_1 | TIMER_ENABLE;
+        return;
+    }
+    sound_free[sound_playing] = 1;
+    if (sound_playing) {
+        sound_restart();
+    }
+    sound_playing ^= 1;
+}
+
+/* function to silence the output, for when the game stops mixing for a while */
+void sound_clear() {
+    memset32(sound_left, 0, SOUND_SAMPLES * 2 / 4);
+    memset32(sound_right, 0, SOUND_SAMPLES * 2 / 4);
+}
+
+/* function to start the sound hardware playing silence */
+void sound_init() {
+    /* the master enable has to go first or the other sound registers do not take */
+    *sound_master = SOUND_ENABLE;
+    *sound_control = SOUND_A_FULL | SOUND_B_FULL | SOUND_A_LEFT | SOUND_A_RESET | SOUND_B_RIGHT | SOUND_B_RESET;
+
+    for (int i = 0; i < SOUND_CHANNELS; i++) {
+        sound_channels[i].active = 0;
+    }
+    sound_clear();
+
+    /* the first frame plays from the next vblank, while the second is mixed */
+    dma[DMA_SOUND_A].destination = (unsigned int) fifo_a;
+    dma[DMA_SOUND_B].destination = (unsigned int) fifo_b;
+    timer[TIMER_SOUND].control = 0;
+    sound_playing = 0;
+    sound_free[0] = 0;
+    sound_free[1] = 1;
+
+    interrupt_set(INT_VBLANK, sound_vblank);
+}
+
+/* function to set a channel's pitch as a sample rate, its volume, and where it is from 0 for the
+ * left to 64 for the right */
+void sound_set(int channel, int rate, int volume, int pan) {
+    if (channel < 0) {
+        return;
+    }
+    struct SoundChannel* sound = &sound_channels[channel];
+    sound->increment = (rate << SOUND_SHIFT) / sound_rate;
+    sound->volume_left = volume * (64 - pan < 32 ? 64 - pan : 32) / 32;
+    sound->volume_right = volume * (pan < 32 ? pan : 32) / 32;
+}
+
+/* function to play a sound on a free channel, returns the channel or -1 if they are all busy */
+int sound_play(const signed char* data, int length, int rate, int volume, int pan, int loop) {
+    for (int i = 0; i < SOUND_CHANNELS; i++) {
+        struct SoundChannel* sound = &sound_channels[i];
+        if (sound->active) {
+            continue;
+        }
+        sound->data = data;
+        sound->position = 0;
+        sound->length = length << SOUND_SHIFT;
+        sound->loop_length = loop ? length << SOUND_SHIFT : 0;
+        sound_set(i, rate, volume, pan);
+        sound->active = 1;
+        return i;
+    }
+    return -1;
+}
+
+/* function to stop a channel */
+void sound_stop(int channel) {
+    if (channel >= 0) {
+        sound_channels[channel].active = 0;
+    }
+}
+
+/* function to mix a frame of sound into one half of the output */
+void sound_mix_half(int half) {
+    memset32(sound_mix_buffer, 0, SOUND_SAMPLES);
+    for (int i = 0; i < SOUND_CHANNELS; i++) {
+        if (sound_channels[i].active) {
+            sound_mix_channel(&sound_channels[i], sound_mix_buffer, SOUND_SAMPLES);
+        }
+    }
+    sound_mix_output(sound_mix_buffer, sound_left + half * SOUND_SAMPLES,
+        sound_right + half * SOUND_SAMPLES, SOUND_SAMPLES);
+}
+
+/* function to mix every frame of output that has finished playing, the one to play next first,
+ * called once a loop: a fast loop finds nothing to do, and a slow one catches up */
+void sound_mix() {
+    unsigned int start = cycles();
+    int next = sound_playing ^ 1;
+
+    for (int i = 0; i < 2; i++) {
+        int half = next ^ i;
+        if (sound_free[half]) {
+            /* cleared first, so a vblank freeing it again while mixing is not lost */
+            sound_free[half] = 0;
+            sound_mix_half(half);
+        }
+    }
+    sound_mix_cycles = cycles() - start;
+}
+
+/* the engine hums faster when the car is moving, and the siren wails louder and from the side
+ * the nearest unit is on */
+#define ENGINE_RATE sound_rate
+#define ENGINE_VOLUME 8
+#define SIREN_RATE (sound_rate * 3)
+#define SIREN_VOLUME 10
+#define CRASH_VOLUME 20
+#define SIREN_RANGE 256
+int engine_channel = -1;
+int siren_channel = -1;
+
+#ifdef SOUND_BENCHMARK
+/* function to time the mix with 4 and then 8 channels playing, showing the average cycles a
+ * frame and the share of a frame on the text layer
+ * no run of it has been recorded yet, the figures so far are estimates counted from the
+ * instruction timings for the mixer in iwram: about 39k and 71k cycles, or 13.9% and 25.2% of
+ * a frame */
+void set_text(char* str, int row, int col);
+void sound_benchmark() {
+    char line[32];
+
+    for (int channels = 4; channels <= 8; channels += 4) {
+        for (int i = 0; i < SOUND_CHANNELS; i++) {
+            sound_channels[i].active = 0;
+        }
+        for (int i = 0; i < channels; i++) {
+            sound_play(sound_engine, sound_engine_length, ENGINE_RATE + i * 1000, SOUND_VOLUME_MAX / 8, 32, 1);
+        }
+
+        unsigned int total = 0;
+        for (int frame = 0; frame < 64; frame++) {
+            unsigned int start = cycles();
+            sound_mix_half(sound_playing ^ 1);
+            total += cycles() - start;
+        }
+        total /= 64;
+        sprintf(line, "%d channels %6u %2u.%u%%", channels, total,
+            total * 100 / FRAME_CYCLES, total * 1000 / FRAME_CYCLES % 10);
+        set_text(line, 5 + channels / 4, 0);
+    }
+
+    for (int i = 0; i < SOUND_CHANNELS; i++) {
+        sound_channels[i].active = 0;
+    }
+}
+#endif
+
+/* blending registers, used for fades and dimming without touching the palettes */
+volatile unsigned short* const blend_control = (volatile unsigned short*) 0x4000050;
+volatile unsigned short* const blend_alpha = (volatile unsigned short*) 0x4000052;
+volatile unsigned short* const blend_brightness = (volatile unsigned short*) 0x4000054;
+
+/* layers blending applies to */
+#define BLEND_BG0 0x01
+#define BLEND_BG1 0x02
+#define BLEND_BG2 0x04
+#define BLEND_BG3 0x08
+#define BLEND_OBJ 0x10
+#define BLEND_BACKDROP 0x20
+#define BLEND_ALL 0x3f
+
+/* blending effects */
+#define BLEND_NONE (0 << 6)
+#define BLEND_ALPHA (1 << 6)
+#define BLEND_WHITE (2 << 6)
+#define BLEND_BLACK (3 << 6)
+
+/* the brightness level goes from 0 to 16, kept here with 8 fractional bits */
+#define BLEND_MAX (16 << 8)
+
+/* night dims the city and the cars but leaves the text readable */
+#define NIGHT_LAYERS (BLEND_BG0 | BLEND_OBJ)
+#define NIGHT_LEVEL 7
+
+/* frames taken by crash flashes and by fades */
+#define FLASH_FRAMES 12
+#define FADE_FRAMES 16
+
+/* the fade or flash in progress, which takes over from night mode while it lasts */
+unsigned short fade_mode = BLEND_NONE;
+int fade_level = 0;
+int fade_target = 0;
+int fade_step = 0;
+int night = 0;
+
+/* function to start moving the brightness to a level over a number of frames */
+void fade_start(unsigned short mode, int from, int to, int frames) {
+    fade_mode = mode;
+    fade_level = from;
+    fade_target = to;
+    fade_step = (to > from ? to - from : from - to) / frames;
+    if (fade_step == 0) {
+        fade_step = 1;
+    }
+}
+
+/* function to fade the whole screen to black */
+void fade_out() {
+    fade_start(BLEND_BLACK | BLEND_ALL, fade_level, BLEND_MAX, FADE_FRAMES);
+}
+
+/* function to fade the whole screen back in from black */
+void fade_in() {
+    fade_start(BLEND_BLACK | BLEND_ALL, BLEND_MAX, 0, FADE_FRAMES);
+}
+
+/* function to flash the screen white, fading back to normal */
+void fade_flash() {
+    fade_start(BLEND_WHITE | BLEND_ALL, BLEND_MAX, 0, FLASH_FRAMES);
+}
+
+/* function to check if a fade is still moving */
+int fade_busy() {
+    return fade_level != fade_target;
+}
+
+/* function to step the fade and write the blend registers, called once per frame in vblank */
+void fade_update() {
+    if (fade_level < fade_target) {
+        fade_level += fade_step;
+        if (fade_level > fade_target) {
+            fade_level = fade_target;
+        }
+    } else if (fade_level > fade_target) {
+        fade_level -= fade_step;
+        if (fade_level < fade_target) {
+            fade_level = fade_target;
+        }
+    }
+
+    if (fade_level > 0) {
+        *blend_control = fade_mode;
+        *blend_brightness = fade_level >> 8;
+    } else if (night) {
+        *blend_control = BLEND_BLACK | NIGHT_LAYERS;
+        *blend_brightness = NIGHT_LEVEL;
+    } else {
+        *blend_control = BLEND_NONE;
+    }
+}
+
+/* function to run the fade to the end before going on */
+void fade_wait() {
+    while (fade_busy()) {
+        wait_next_vblank();
+        fade_update();
+        sound_mix();
+    }
+}
+
+/* the world is built from chunks of 16x16 pixel metatiles */
+#define METATILE_SIZE 16
+#define WORLD_METATILES_WIDTH (world_chunks_width * chunk_size)
+#define WORLD_METATILES_HEIGHT (world_chunks_height * chunk_size)
+#define WORLD_WIDTH (WORLD_METATILES_WIDTH * METATILE_SIZE)
+#define WORLD_HEIGHT (WORLD_METATILES_HEIGHT * METATILE_SIZE)
+
+/* collision classes of the world tiles, from the collision map made by mapconv */
+#define TILE_ROAD 0
+#define TILE_SIDEWALK 1
+#define TILE_SOLID 2
+#define TILE_WATER 3
+
+/* collision_box returns a mask with a bit set for each class it touches */
+#define CLASS_BIT(class) (1 << (class))
+
+/* cars can drive on roads and sidewalks, but not into buildings or water */
+#define CAR_BLOCKED (CLASS_BIT(TILE_SOLID) | CLASS_BIT(TILE_WATER))
+
+/* function to get the collision class at a world pixel, outside the world is solid */
+int collision_point(int x, int y) {
+    if ((unsigned int) x >= WORLD_WIDTH || (unsigned int) y >= WORLD_HEIGHT) {
+        return TILE_SOLID;
+    }
+    int tx = x >> 3;
+    unsigned int word = collision_map[(y >> 3) * collision_words_per_row + (tx >> 4)];
+    return (word >> ((tx & 15) * 2)) & 3;
+}
+
+/* function to get the mask of collision classes under a box of world pixels */
+int collision_box(int x, int y, int width, int height) {
+    if (x < 0 || y < 0 || x + width > WORLD_WIDTH || y + height > WORLD_HEIGHT) {
+        return CLASS_BIT(TILE_SOLID);
+    }
+
+    int left = x >> 3;
+    int right = (x + width - 1) >> 3;
+    int top = y >> 3;
+    int bottom = (y + height - 1) >> 3;
+    int mask = 0;
+
+    for (int ty = top; ty <= bottom; ty++) {
+        const unsigned int* row = &collision_map[ty * collision_words_per_row];
+        for (int tx = left; tx <= right; tx++) {
+            mask |= 1 << ((row[tx >> 4] >> ((tx & 15) * 2)) & 3);
+        }
+    }
+    return mask;
+}
+
+/* function to move a box one axis at a time, going as far as it can before touching a
+ * blocked class, returns 1 if it was stopped short */
+int collision_sweep(int* x, int* y, int width, int height, int dx, int dy, int blocked) {
+    int stopped = 0;
+    int step = dx < 0 ? -1 : 1;
+
+    for (int moved = 0; moved != dx; moved += step) {
+        if (collision_box(*x + step, *y, width, height) & blocked) {
+            stopped = 1;
+            break;
+        }
+        *x += step;
+    }
+
+    step = dy < 0 ? -1 : 1;
+    for (int moved = 0; moved != dy; moved += step) {
+        if (collision_box(*x, *y + step, width, height) & blocked) {
+            stopped = 1;
+            break;
+        }
+        *y += step;
+    }
+    return stopped;
+}
+
+/* size of the car sprites */
+#define CAR_WIDTH 32
+#define CAR_HEIGHT 16
+
+/* car struct, positions are in world pixels */
+struct Car {
+    struct Sprite* sprite;
+    int x, y;
+    int dx, dy;
+    int frame;
+    int counter;
+    int angle;
+    float move;
+    /* set while the car is in or near the view, cleared when it is culled */
+    int visible;
+    /* frames the car has been turning as hard as it can one way, negative to the left */
+    int skid;
+};
+
+/* every car, so they can all be put on the screen together */
+#define MAX_CARS 32
+struct Car* cars[MAX_CARS];
+int num_cars = 0;
+
+/* the cars themselves come from a pool, chained through the counter while they are free */
+struct Car car_storage[MAX_CARS];
+struct Pool car_pool;
+
+/* function to set up the car pool, with no cars in play */
+void car_pool_init() {
+    pool_init(&car_pool, car_storage, sizeof(struct Car), MAX_CARS, offsetof(struct Car, counter));
+    num_cars = 0;
+}
+
+/* initializing car sprite */
+void car_init(struct Car* car, int x, int y, int frame) {
+    car->x = x;
+    car->y = y;
+    car->dx = 0;
+    car->dy = 0;
+    car->frame = frame;
+    car->counter = 0;
+    car->angle = 0;
+    car->move = 0;
+    car->visible = 1;
+    car->skid = 0;
+    car->sprite = sprite_init(car->x, car->y, SIZE_32_16, 0, 0, car->frame, 0);
+    cars[num_cars++] = car;
+}
+
+/* function to put a new car in play, returning 0 when there is no car or sprite for it */
+struct Car* car_spawn(int x, int y, int frame) {
+    struct Car* car = pool_acquire(&car_pool);
+    if (!car) {
+        return 0;
+    }
+    car_init(car, x, y, frame);
+    if (!car->sprite) {
+        num_cars--;
+        pool_release(&car_pool, car);
+        return 0;
+    }
+    return car;
+}
+
+/* function to take a car out of play, giving back its sprite */
+void car_despawn(struct Car* car) {
+    for (int i = 0; i < num_cars; i++) {
+        if (cars[i] == car) {
+            cars[i] = cars[--num_cars];
+            break;
+        }
+    }
+    sprite_free(car->sprite);
+    pool_release(&car_pool, car);
+}
+
+/* function to move a car, stopping it at anything it cannot drive into */
+int car_move(struct Car* car, int dx, int dy) {
+    return collision_sweep(&car->x, &car->y, CAR_WIDTH, CAR_HEIGHT, dx, dy, CAR_BLOCKED);
+}
+
+/* function to move the car left */
+void car_left(struct Car* car) {
+    car->move = 1;
+    car->dx = -1;
+    car_move(car, -1, 0);
+}
+
+/* function to move the car right */
+void car_right(struct Car* car) {
+    car->move = 1;
+    car->dx = 1;
+    car_move(car, 1, 0);
+}
+
+/* function to move the car up */
+void car_up(struct Car* car) {
+    car->move = 1;
+    car->dy = -1;
+    car_move(car, 0, -1);
+}
+
+/* function to move the car down */
+void car_down(struct Car* car) {
+    car->move = 1;
+    car->dy = 1;
+    car_move(car, 0, 1);
+}
+
+/* angle a car faces for each direction it can move, indexed by (dy + 1) * 3 + dx + 1,
+ * where a full turn is 256 and 0 faces right */
+const short direction_angles[9] = {160, 192, 224, 128, -1, 0, 96, 64, 32};
+#define TURN_SPEED 8
+
+/* a hard turn has to be held the same way for SKID_FRAMES before it skids, and then leaves
+ * a mark every SKID_INTERVAL frames */
+#define SKID_FRAMES 4
+#define SKID_INTERVAL 4
+
+/* function to turn a car a little towards the way it is moving, returns 1 when it is skidding
+ * round a turn, a car flipping its heading each frame does not count, as police units chasing
+ * on a diagonal do since they go across and down on alternate frames */
+int car_turn(struct Car* car) {
+    int target = direction_angles[(car->dy + 1) * 3 + car->dx + 1];
+    if (target < 0) {
+        return 0;
+    }
+
+    /* nobody sees a culled car turn, so it faces the right way at once */
+    if (!car->visible) {
+        car->angle = target;
+        car->skid = 0;
+        return 0;
+    }
+
+    int difference = (signed char) (target - car->angle);
+    int hard = 0;
+    if (difference > TURN_SPEED) {
+        difference = TURN_SPEED;
+        hard = 1;
+    } else if (difference < -TURN_SPEED) {
+        difference = -TURN_SPEED;
+        hard = -1;
+    }
+    car->angle = (car->angle + difference) & (lut_angles - 1);
+
+    /* count the frames turning hard the same way, starting again when it eases off or swaps */
+    if (!hard || hard * car->skid < 0) {
+        car->skid = 0;
+    }
+    car->skid += hard;
+    int frames = car->skid < 0 ? -car->skid : car->skid;
+    return frames >= SKID_FRAMES && (frames - SKID_FRAMES) % SKID_INTERVAL == 0;
+}
+
+/* function to make the car stop moving */
 void car_stop(struct Car* car) {
     car->move = 0;
+    car->dx = 0;
+    car->dy = 0;
     car->counter = 7;
     sprite_set_offset(car->sprite, car->frame);
 }
 
-/* updates the position of the car */
-void car_update(struct Car* car) {
-    sprite_position(car->sprite, car->x, car->y);
+/* the camera position and look ahead are in pixels with 8 fractional bits */
+#define CAMERA_SHIFT 8
+
+/* the player can move this far from the middle of the screen before the camera follows */
+#define DEAD_ZONE_X 24
+#define DEAD_ZONE_Y 16
+
+/* how far ahead of a moving car the camera looks, and how quickly it gets there */
+#define LOOK_AHEAD_X 40
+#define LOOK_AHEAD_Y 24
+#define LOOK_AHEAD_SHIFT 5
+
+/* the camera covers this fraction of the distance to where it wants to be each frame */
+#define CAMERA_SMOOTH_SHIFT 3
+
+/* camera struct, x and y are the world position of the top left of the screen */
+struct Camera {
+    int x, y;
+    int look_x, look_y;
+};
+
+struct Camera camera;
+
+/* function to keep the camera inside the world */
+void camera_clamp() {
+    if (camera.x < 0) {
+        camera.x = 0;
+    } else if (camera.x > (WORLD_WIDTH - SCREEN_WIDTH) << CAMERA_SHIFT) {
+        camera.x = (WORLD_WIDTH - SCREEN_WIDTH) << CAMERA_SHIFT;
+    }
+    if (camera.y < 0) {
+        camera.y = 0;
+    } else if (camera.y > (WORLD_HEIGHT - SCREEN_HEIGHT) << CAMERA_SHIFT) {
+        camera.y = (WORLD_HEIGHT - SCREEN_HEIGHT) << CAMERA_SHIFT;
+    }
 }
 
-/* updates the position of the police car */
-void policecar_update(struct Car* car) {
-    sprite_position(car->sprite, car->x/2, car->y);
+/* function to put the camera straight onto a car, with no smoothing */
+void camera_snap(struct Car* car) {
+    camera.x = (car->x + CAR_WIDTH / 2 - SCREEN_WIDTH / 2) << CAMERA_SHIFT;
+    camera.y = (car->y + CAR_HEIGHT / 2 - SCREEN_HEIGHT / 2) << CAMERA_SHIFT;
+    camera.look_x = 0;
+    camera.look_y = 0;
+    camera_clamp();
 }
 
-/* function to move the police car based on the player's car position */
-void move_police(struct Car* policecar, struct Car* currentcar){
-    int policex = policecar->x/2;
-    if (((currentcar->x) > policex)){
-        policecar_right(policecar, currentcar);
+/* function to work out one axis of the camera, moving the dead zone just far enough to hold
+ * the point the camera is looking at and then easing the camera towards that */
+int camera_axis(int position, int target, int half_screen, int dead_zone) {
+    int centre = position + (half_screen << CAMERA_SHIFT);
+    int wanted = centre;
+
+    if (target > centre + (dead_zone << CAMERA_SHIFT)) {
+        wanted = target - (dead_zone << CAMERA_SHIFT);
+    } else if (target < centre - (dead_zone << CAMERA_SHIFT)) {
+        wanted = target + (dead_zone << CAMERA_SHIFT);
     }
-    else if (((currentcar->x) < policex)){
-        policecar_left(policecar);
+
+    return position + ((wanted - centre) >> CAMERA_SMOOTH_SHIFT);
+}
+
+/* function to move the camera after a car, looking ahead in the direction it is going */
+void camera_follow(struct Car* car) {
+    camera.look_x += ((car->dx * LOOK_AHEAD_X << CAMERA_SHIFT) - camera.look_x) >> LOOK_AHEAD_SHIFT;
+    camera.look_y += ((car->dy * LOOK_AHEAD_Y << CAMERA_SHIFT) - camera.look_y) >> LOOK_AHEAD_SHIFT;
+
+    int target_x = ((car->x + CAR_WIDTH / 2) << CAMERA_SHIFT) + camera.look_x;
+    int target_y = ((car->y + CAR_HEIGHT / 2) << CAMERA_SHIFT) + camera.look_y;
+
+    camera.x = camera_axis(camera.x, target_x, SCREEN_WIDTH / 2, DEAD_ZONE_X);
+    camera.y = camera_axis(camera.y, target_y, SCREEN_HEIGHT / 2, DEAD_ZONE_Y);
+    camera_clamp();
+}
+
+/* set when the city is drawn on the rotating affine background instead, along with the
+ * view's zoom and how far it turns everything on the screen, which are set by view_update */
+int view_affine = 0;
+int view_zoom;
+int view_turn;
+
+/* the middle of the ground the affine view shows, which the map window is kept around */
+int view_focus_x = 0;
+int view_focus_y = 0;
+int view_project(struct Car* car, int* x, int* y);
+
+/* function to put every car sprite at its place on the screen, turned to its heading, and
+ * hiding the ones off it */
+void camera_project_all() {
+    int left = camera.x >> CAMERA_SHIFT;
+    int top = camera.y >> CAMERA_SHIFT;
+
+    affine_begin(view_affine ? view_zoom : 1 << 8);
+
+    for (int i = 0; i < num_cars; i++) {
+        struct Car* car = cars[i];
+        int x = car->x - left;
+        int y = car->y - top;
+        int angle = car->angle;
+
+        /* culled cars skip the projection and oam altogether */
+        if (!car->visible) {
+            sprite_hide(car->sprite);
+            continue;
+        }
+
+        if (view_affine) {
+            angle += view_turn;
+            if (!view_project(car, &x, &y)) {
+                x = SCREEN_WIDTH;
+            }
+        }
+
+        if (x <= -CAR_WIDTH || x >= SCREEN_WIDTH || y <= -CAR_HEIGHT || y >= SCREEN_HEIGHT) {
+            sprite_hide(car->sprite);
+        } else {
+            /* a double size sprite is drawn centred on where the normal one would be */
+            sprite_set_affine(car->sprite, affine_matrix(angle));
+            sprite_position(car->sprite, x - CAR_WIDTH / 2, y - CAR_HEIGHT / 2);
+        }
     }
-    else{
-        policecar_right(policecar, currentcar);
+}
+
+/* function to scroll the city to the camera, the text layer stays where it is, called in vblank */
+void camera_apply() {
+    bg_scroll(0, camera.x >> CAMERA_SHIFT, camera.y >> CAMERA_SHIFT);
+}
+
+/* the city background is 512x512 pixels over screen blocks 16 to 19, holding a window of
+ * 32x32 metatiles of the world, wrapped so a metatile always lands in the same place */
+#define LAYOUT_METATILES 32
+
+/* the layout of vram from vram.h, checked when compiling so a bigger asset cannot spill into the
+ * next block: char block 0 has the city tiles, char block 1 the font, then the maps from screen
+ * block 16 on */
+_Static_assert(background_width * background_height <= CHAR_BLOCK_SIZE, "the city tiles overflow char block 0");
+_Static_assert(font_glyphs * 64 <= CHAR_BLOCK_SIZE, "the font overflows char block 1");
+_Static_assert(LAYOUT_SCREEN_BLOCK * SCREEN_BLOCK_SIZE >= 2 * CHAR_BLOCK_SIZE, "the city map overlaps the font");
+_Static_assert(AFFINE_SCREEN_BLOCK >= LAYOUT_SCREEN_BLOCK + 4, "the affine map overlaps the city map");
+_Static_assert(TEXT_SCREEN_BLOCK >= AFFINE_SCREEN_BLOCK + 2, "the text map overlaps the affine map");
+_Static_assert(TEXT_SCREEN_BLOCK < 32, "the text map is past the end of background vram");
+_Static_assert(OBJ_TILE_END * 32 <= OBJ_MEMORY_SIZE, "the sprites overflow sprite memory");
+
+/* the window is kept this many metatiles to the left of and above the camera */
+#define WINDOW_MARGIN_X ((LAYOUT_METATILES - SCREEN_WIDTH / METATILE_SIZE) / 2)
+#define WINDOW_MARGIN_Y ((LAYOUT_METATILES - SCREEN_HEIGHT / METATILE_SIZE) / 2)
+
+/* top left metatile of the window of the world that is in the background */
+int window_x = 0;
+int window_y = 0;
+
+/* function to look up the metatile at a place in the world */
+int world_metatile(int mx, int my) {
+    int chunk = world_chunks[(my / chunk_size) * world_chunks_width + (mx / chunk_size)];
+    return chunks[chunk * chunk_size * chunk_size + (my % chunk_size) * chunk_size + (mx % chunk_size)];
+}
+
+/* function to write the four tiles of a world metatile into the background */
+void map_expand_metatile(int mx, int my) {
+    const unsigned short* tiles = &metatiles[world_metatile(mx, my) * 4];
+    int tx = (mx % LAYOUT_METATILES) * 2;
+    int ty = (my % LAYOUT_METATILES) * 2;
+
+    /* the affine map is one byte per tile with no flips, so each row of the metatile is a halfword */
+    if (view_affine) {
+        volatile unsigned short* map = screen_block(AFFINE_SCREEN_BLOCK);
+        int offset = (ty * 64 + tx) / 2;
+        map[offset] = (tiles[0] & 0xff) | ((tiles[1] & 0xff) << 8);
+        map[offset + 32] = (tiles[2] & 0xff) | ((tiles[3] & 0xff) << 8);
+        return;
     }
-    
-    int currenty = currentcar->y;
-    if (((currentcar->y) < 73) & ((policecar->y) > currenty)){
-        car_up(policecar);  
+
+    volatile unsigned short* block = screen_block(LAYOUT_SCREEN_BLOCK + (ty / 32) * 2 + (tx / 32));
+    int offset = (ty % 32) * 32 + (tx % 32);
+
+    block[offset] = tiles[0];
+    block[offset + 1] = tiles[1];
+    block[offset + 32] = tiles[2];
+    block[offset + 33] = tiles[3];
+}
+
+/* function to expand one column of the window */
+void map_expand_column(int mx) {
+    for (int my = window_y; my < window_y + LAYOUT_METATILES && my < WORLD_METATILES_HEIGHT; my++) {
+        map_expand_metatile(mx, my);
     }
-    else if (((currentcar->y) > 73) & ((policecar->y) < currenty)){
-        car_down(policecar);
+}
+
+/* function to expand one row of the window */
+void map_expand_row(int my) {
+    for (int mx = window_x; mx < window_x + LAYOUT_METATILES && mx < WORLD_METATILES_WIDTH; mx++) {
+        map_expand_metatile(mx, my);
+    }
+}
+
+/* function to work out where the window should be for a screen at position, on one axis */
+int map_window_target(int position, int margin, int world) {
+    int target = position / METATILE_SIZE - margin;
+    if (target > world - LAYOUT_METATILES) {
+        target = world - LAYOUT_METATILES;
+    }
+    if (target < 0) {
+        target = 0;
+    }
+    return target;
+}
+
+/* function to find the top left of the screen the window is kept around: the camera's, or in
+ * the affine view one centred on the ground it shows, which in perspective is well ahead */
+void map_focus(int* x, int* y) {
+    if (view_affine) {
+        *x = view_focus_x - SCREEN_WIDTH / 2;
+        *y = view_focus_y - SCREEN_HEIGHT / 2;
+    } else {
+        *x = camera.x >> CAMERA_SHIFT;
+        *y = camera.y >> CAMERA_SHIFT;
+    }
+}
+
+/* function to fill the whole window around the camera */
+void map_load() {
+    int x, y;
+    map_focus(&x, &y);
+    window_x = map_window_target(x, WINDOW_MARGIN_X, WORLD_METATILES_WIDTH);
+    window_y = map_window_target(y, WINDOW_MARGIN_Y, WORLD_METATILES_HEIGHT);
+
+    for (int my = window_y; my < window_y + LAYOUT_METATILES && my < WORLD_METATILES_HEIGHT; my++) {
+        map_expand_row(my);
+    }
+}
+
+/* function to slide the window after the camera, expanding only the column or row that comes
+ * into it, called in vblank after the camera has moved */
+void map_stream() {
+    int x, y;
+    map_focus(&x, &y);
+    int target_x = map_window_target(x, WINDOW_MARGIN_X, WORLD_METATILES_WIDTH);
+    int target_y = map_window_target(y, WINDOW_MARGIN_Y, WORLD_METATILES_HEIGHT);
+
+    while (window_x < target_x) {
+        map_expand_column(window_x + LAYOUT_METATILES);
+        window_x++;
+    }
+    while (window_x > target_x) {
+        window_x--;
+        map_expand_column(window_x);
+    }
+    while (window_y < target_y) {
+        map_expand_row(window_y + LAYOUT_METATILES);
+        window_y++;
+    }
+    while (window_y > target_y) {
+        window_y--;
+        map_expand_row(window_y);
+    }
+}
+
+/* display settings for the normal and the affine views */
+#define DISPLAY_NORMAL (MODE0 | BG0_ENABLE | BG1_ENABLE | SPRITE_ENABLE | SPRITE_MAP_1D | HBLANK_OAM_ACCESS)
+#define DISPLAY_AFFINE (MODE1 | BG1_ENABLE | BG2_ENABLE | SPRITE_ENABLE | SPRITE_MAP_1D | HBLANK_OAM_ACCESS)
+
+/* the zoom is in texels per pixel with 8 fractional bits, and eases out while moving */
+#define ZOOM_STILL 256
+#define ZOOM_MOVING 352
+#define ZOOM_SHIFT 4
+
+/* in perspective the player sits on PLAYER_LINE, and HORIZON_OFFSET lines above the screen
+ * is where the ground would meet the horizon, the zoom stays at ZOOM_STILL */
+#define PLAYER_LINE 112
+#define HORIZON_OFFSET 176
+#define PERSPECTIVE_DEPTH (PLAYER_LINE + HORIZON_OFFSET)
+
+/* the ground the perspective view shows is a trapezoid: the top line's scale, how far ahead
+ * of the player it is and half its width, and how far behind the bottom line is, in pixels */
+#define PERSPECTIVE_TOP_SCALE (ZOOM_STILL * PERSPECTIVE_DEPTH / HORIZON_OFFSET)
+#define PERSPECTIVE_TOP_FORWARD (PERSPECTIVE_DEPTH * (PERSPECTIVE_TOP_SCALE - ZOOM_STILL) >> 8)
+#define PERSPECTIVE_TOP_HALF ((SCREEN_WIDTH / 2) * PERSPECTIVE_TOP_SCALE >> 8)
+#define PERSPECTIVE_BOTTOM_SCALE (ZOOM_STILL * PERSPECTIVE_DEPTH / (SCREEN_HEIGHT + HORIZON_OFFSET))
+#define PERSPECTIVE_BOTTOM_BACK (PERSPECTIVE_DEPTH * (ZOOM_STILL - PERSPECTIVE_BOTTOM_SCALE) >> 8)
+
+/* the map window is centred on the trapezoid, and is only 512 pixels across, so at any heading
+ * the trapezoid has to fit in a circle that stays clear of the window's edges as it steps along
+ * a metatile at a time, or the far lines show tiles wrapped around from the other side */
+#define PERSPECTIVE_HALF_DEPTH ((PERSPECTIVE_TOP_FORWARD + PERSPECTIVE_BOTTOM_BACK) / 2)
+#define WINDOW_CLEAR_RADIUS (LAYOUT_METATILES * METATILE_SIZE / 2 - METATILE_SIZE - 8)
+_Static_assert(PERSPECTIVE_HALF_DEPTH * PERSPECTIVE_HALF_DEPTH + PERSPECTIVE_TOP_HALF * PERSPECTIVE_TOP_HALF
+    <= WINDOW_CLEAR_RADIUS * WINDOW_CLEAR_RADIUS, "the perspective view reaches past the map window");
+_Static_assert(SCREEN_HEIGHT + HORIZON_OFFSET < lut_reciprocals, "the perspective view needs a longer reciprocal table");
+
+/* the affine registers for one scanline, in the order they sit in memory */
+struct AffineLine {
+    short pa, pb, pc, pd;
+    int x, y;
+};
+
+/* affine registers for background 2, the matrix and the reference point, laid out as a line */
+volatile struct AffineLine* const bg2_affine = (volatile struct AffineLine*) 0x4000020;
+
+/* the single matrix of the flat view, and the per scanline tables of the perspective view,
+ * one being shown by hblank dma while the other is worked out */
+struct AffineLine view_matrix;
+struct AffineLine view_lines[2][SCREEN_HEIGHT + 1] EWRAM_BSS;
+int view_buffer = 0;
+
+/* the view state used to work out the sprite positions */
+int view_perspective = 0;
+int view_zoom = ZOOM_STILL;
+int view_centre_x = 0;
+int view_centre_y = 0;
+int view_sin = 0;
+int view_cos = 1 << lut_sin_shift;
+
+/* function to work out the affine registers, with the player's heading pointing up the screen */
+void view_update(struct Car* player) {
+    int target = ((player->dx || player->dy) && !view_perspective) ? ZOOM_MOVING : ZOOM_STILL;
+    view_zoom += (target - view_zoom) >> ZOOM_SHIFT;
+
+    view_turn = lut_angles * 3 / 4 - player->angle;
+    view_sin = sin_lut[player->angle];
+    view_cos = sin_lut[(player->angle + lut_angles / 4) & (lut_angles - 1)];
+    view_centre_x = player->x + CAR_WIDTH / 2;
+    view_centre_y = player->y + CAR_HEIGHT / 2;
+    view_focus_x = view_centre_x;
+    view_focus_y = view_centre_y;
+
+    int x = view_centre_x << 8;
+    int y = view_centre_y << 8;
+
+    if (!view_perspective) {
+        /* screen right is the heading turned a quarter clockwise, screen down is backwards */
+        int sine = (view_sin * view_zoom) >> lut_sin_shift;
+        int cosine = (view_cos * view_zoom) >> lut_sin_shift;
+        view_matrix.pa = -sine;
+        view_matrix.pb = -cosine;
+        view_matrix.pc = cosine;
+        view_matrix.pd = -sine;
+        view_matrix.x = x + sine * (SCREEN_WIDTH / 2) + cosine * (SCREEN_HEIGHT / 2);
+        view_matrix.y = y - cosine * (SCREEN_WIDTH / 2) + sine * (SCREEN_HEIGHT / 2);
+        return;
+    }
+
+    /* each line gets its own scale, shrinking towards the bottom, and starts the distance
+     * ahead of the player that scale puts it at */
+    struct AffineLine* lines = view_lines[view_buffer];
+    int top_forward = 0;
+    int forward = 0;
+    for (int line = 0; line <= SCREEN_HEIGHT; line++) {
+        int scale = (view_zoom * PERSPECTIVE_DEPTH * reciprocal_lut[line + HORIZON_OFFSET]) >> 16;
+        forward = PERSPECTIVE_DEPTH * (scale - view_zoom);
+        if (line == 0) {
+            top_forward = forward;
+        }
+        int sine = (view_sin * scale) >> lut_sin_shift;
+        int cosine = (view_cos * scale) >> lut_sin_shift;
+
+        lines[line].pa = -sine;
+        lines[line].pb = 0;
+        lines[line].pc = cosine;
+        lines[line].pd = 0;
+        lines[line].x = x + ((view_cos * forward) >> lut_sin_shift) + sine * (SCREEN_WIDTH / 2);
+        lines[line].y = y + ((view_sin * forward) >> lut_sin_shift) - cosine * (SCREEN_WIDTH / 2);
+    }
+
+    /* the map window goes around the middle of the ground shown, half way between the top
+     * line ahead and the bottom line behind */
+    int middle = (top_forward + forward) / 2;
+    view_focus_x += ((view_cos * middle) >> lut_sin_shift) >> 8;
+    view_focus_y += ((view_sin * middle) >> lut_sin_shift) >> 8;
+}
+
+/* function to find where a point in the world appears in the affine view, returns 0 if it can not be seen */
+int view_project_point(int world_x, int world_y, int* x, int* y) {
+    int dx = world_x - view_centre_x;
+    int dy = world_y - view_centre_y;
+    int forward = (dx * view_cos + dy * view_sin) >> lut_sin_shift;
+    int right = (dy * view_cos - dx * view_sin) >> lut_sin_shift;
+    int scale = view_zoom;
+    int line;
+
+    if (view_perspective) {
+        scale = view_zoom + (forward << 8) / PERSPECTIVE_DEPTH;
+        if (scale <= 0) {
+            return 0;
+        }
+        line = view_zoom * PERSPECTIVE_DEPTH / scale - HORIZON_OFFSET;
+        if (line < 0) {
+            return 0;
+        }
+    } else {
+        line = SCREEN_HEIGHT / 2 - (forward << 8) / scale;
+    }
+
+    *x = SCREEN_WIDTH / 2 + (right << 8) / scale;
+    *y = line;
+    return 1;
+}
+
+/* function to find where a car appears in the affine view, returns 0 if it can not be seen */
+int view_project(struct Car* car, int* x, int* y) {
+    if (!view_project_point(car->x + CAR_WIDTH / 2, car->y + CAR_HEIGHT / 2, x, y)) {
+        return 0;
+    }
+    *x -= CAR_WIDTH / 2;
+    *y -= CAR_HEIGHT / 2;
+    return 1;
+}
+
+/* function to load the affine registers, and start the hblank dma for perspective, called in vblank */
+void view_apply() {
+    if (!view_affine) {
+        return;
+    }
+
+    dma[DMA_HBLANK_AFFINE].count = 0;
+    struct AffineLine* line = view_perspective ? view_lines[view_buffer] : &view_matrix;
+
+    /* the matrix goes in as two pairs of halfwords, each with one 32 bit store */
+    volatile unsigned int* matrix = (volatile unsigned int*) bg2_affine;
+    matrix[0] = (line->pa & 0xffff) | ((unsigned int) line->pb << 16);
+    matrix[1] = (line->pc & 0xffff) | ((unsigned int) line->pd << 16);
+    bg2_affine->x = line->x;
+    bg2_affine->y = line->y;
+
+    /* each hblank loads the registers for the next line */
+    if (view_perspective) {
+        dma_start(DMA_HBLANK_AFFINE, bg2_affine, line + 1,
+            (sizeof(struct AffineLine) / 4) | DMA_32 | DMA_REPEAT | DMA_DEST_RELOAD | DMA_HBLANK | DMA_ENABLE);
+        dma_bytes += SCREEN_HEIGHT * sizeof(struct AffineLine);
+        view_buffer ^= 1;
+    }
+}
+
+/* function to switch between the normal and the affine view of the city */
+void view_set(int affine) {
+    view_affine = affine;
+    dma[DMA_HBLANK_AFFINE].count = 0;
+
+    if (affine) {
+        bg_control[2] = 1 |
+            (0 << 2) |
+            (AFFINE_SCREEN_BLOCK << 8) |
+            (1 << 13) |
+            (2 << 14);
+        *display_control = DISPLAY_AFFINE;
+    } else {
+        *display_control = DISPLAY_NORMAL;
+    }
+
+    /* until view_update has run the affine view is around the middle of the screen */
+    view_focus_x = (camera.x >> CAMERA_SHIFT) + SCREEN_WIDTH / 2;
+    view_focus_y = (camera.y >> CAMERA_SHIFT) + SCREEN_HEIGHT / 2;
+    map_load();
+}
+
+/* cars within this many pixels of the view keep the full simulation, so one coming into
+ * view has already been moving normally for a while */
+#define CULL_MARGIN 48
+
+/* culled cars move this many frames' worth at once, on one frame in this many */
+#define CULL_RATE 4
+
+/* the box of the world that counts as in view this frame */
+int cull_left, cull_top, cull_right, cull_bottom;
+
+/* function to work out the box of the world in view, for the affine view a square around its
+ * centre big enough for the zoom, and twice that for perspective which shows further ahead */
+void cull_update() {
+    if (view_affine) {
+        /* the zoom is in texels per pixel, so zooming out widens the ground shown, and in
+         * perspective the ground shown fits a circle of WINDOW_CLEAR_RADIUS round the focus */
+        int reach = ((SCREEN_WIDTH + SCREEN_HEIGHT) / 2 * view_zoom) >> 8;
+        if (view_perspective) {
+            reach = WINDOW_CLEAR_RADIUS;
+        }
+        cull_left = view_focus_x - reach;
+        cull_right = view_focus_x + reach;
+        cull_top = view_focus_y - reach;
+        cull_bottom = view_focus_y + reach;
+    } else {
+        cull_left = camera.x >> CAMERA_SHIFT;
+        cull_top = camera.y >> CAMERA_SHIFT;
+        cull_right = cull_left + SCREEN_WIDTH;
+        cull_bottom = cull_top + SCREEN_HEIGHT;
+    }
+    cull_left -= CULL_MARGIN + CAR_WIDTH;
+    cull_top -= CULL_MARGIN + CAR_HEIGHT;
+    cull_right += CULL_MARGIN;
+    cull_bottom += CULL_MARGIN;
+}
+
+/* function to mark which cars are in or near the view */
+void cull_all() {
+    cull_update();
+    for (int i = 0; i < num_cars; i++) {
+        struct Car* car = cars[i];
+        car->visible = car->x >= cull_left && car->x < cull_right && car->y >= cull_top && car->y < cull_bottom;
+    }
+}
+
+/* particles are kept as separate arrays, one per field, so the update loop streams through
+ * each of them, positions and speeds are in world pixels with 8 fractional bits */
+#define MAX_PARTICLES 64
+#define PARTICLE_SHIFT 8
+
+int particle_x[MAX_PARTICLES];
+int particle_y[MAX_PARTICLES];
+short particle_dx[MAX_PARTICLES];
+short particle_dy[MAX_PARTICLES];
+unsigned char particle_life[MAX_PARTICLES];
+unsigned char particle_type[MAX_PARTICLES];
+struct Sprite* particle_sprite[MAX_PARTICLES];
+int particle_count = 0;
+
+/* the kinds of particle */
+#define PARTICLE_SPARK 0
+#define PARTICLE_SMOKE 1
+#define PARTICLE_SKID 2
+#define PARTICLE_TYPES 3
+
+/* how long each kind lasts in frames, how quickly it slows down, and the layer it is drawn on,
+ * skid marks going under the cars */
+const unsigned char particle_lives[PARTICLE_TYPES] = {16, 40, 90};
+const unsigned char particle_drag[PARTICLE_TYPES] = {3, 4, 0};
+const unsigned char particle_layers[PARTICLE_TYPES] = {0, 0, 1};
+
+/* each kind is an 8x8 shape of one color, stored as a bit per pixel and drawn into sprite
+ * memory after the cars at boot, at PARTICLE_TILE from vram.h */
+_Static_assert(PARTICLE_TYPES * 2 == PARTICLE_TILES, "vram.h has the wrong number of particle tiles");
+const unsigned char particle_shapes[PARTICLE_TYPES][8] = {
+    {0x00, 0x00, 0x10, 0x38, 0x10, 0x00, 0x00, 0x00},
+    {0x00, 0x18, 0x3c, 0x7e, 0x7e, 0x3c, 0x18, 0x00},
+    {0x00, 0x00, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00}
+};
+const unsigned char particle_colors[PARTICLE_TYPES] = {5, STEADY_GREY, 8};
+
+/* the limit on live particles drops when frames run long and creeps back up when they do not,
+ * so a busy frame gets fewer particles instead of missing its vblank */
+#define PARTICLE_MIN 8
+#define VDRAW_CYCLES (SCREEN_HEIGHT * 1232)
+#define PARTICLE_BUSY (VDRAW_CYCLES * 3 / 4)
+#define PARTICLE_IDLE (VDRAW_CYCLES / 2)
+int particle_limit = MAX_PARTICLES;
+
+/* state of the random numbers used to scatter particles */
+unsigned int random_state = 1;
+
+/* function to get a random number from 0 to 65535 */
+int random_next() {
+    random_state = random_state * 1103515245 + 12345;
+    return random_state >> 16;
+}
+
+/* function to draw an 8x8 shape of one color, stored as a bit per pixel, into an 8 bit sprite tile */
+void sprite_draw_shape(int tile_index, const unsigned char* shape, int color) {
+    volatile unsigned short* tile = sprite_image_memory + tile_index * 16;
+    for (int row = 0; row < 8; row++) {
+        int bits = shape[row];
+        for (int pair = 0; pair < 4; pair++) {
+            int left = (bits >> (7 - pair * 2)) & 1 ? color : 0;
+            int right = (bits >> (6 - pair * 2)) & 1 ? color : 0;
+            tile[row * 4 + pair] = left | (right << 8);
+        }
+    }
+}
+
+/* function to draw the particle shapes into sprite memory, in 8 bit color like the cars */
+void particle_init() {
+    for (int type = 0; type < PARTICLE_TYPES; type++) {
+        sprite_draw_shape(PARTICLE_TILE + type * 2, particle_shapes[type], particle_colors[type]);
+    }
+    particle_count = 0;
+}
+
+/* function to start a particle at a place in the world with a speed in 1/256 pixels a frame,
+ * returns 0 when the limit is reached or there is no sprite for it */
+int particle_spawn(int type, int x, int y, int dx, int dy) {
+    if (particle_count >= particle_limit) {
+        return 0;
+    }
+    struct Sprite* sprite = sprite_init(SCREEN_WIDTH, SCREEN_HEIGHT, SIZE_8_8, 0, 0,
+        PARTICLE_TILE + type * 2, particle_layers[type]);
+    if (!sprite) {
+        return 0;
+    }
+
+    int i = particle_count++;
+    particle_x[i] = x << PARTICLE_SHIFT;
+    particle_y[i] = y << PARTICLE_SHIFT;
+    particle_dx[i] = dx;
+    particle_dy[i] = dy;
+    particle_life[i] = particle_lives[type];
+    particle_type[i] = type;
+    particle_sprite[i] = sprite;
+    return 1;
+}
+
+/* function to throw out particles in random directions at up to a speed */
+void particle_burst(int type, int x, int y, int count, int speed) {
+    for (int i = 0; i < count; i++) {
+        int angle = random_next() & (lut_angles - 1);
+        int amount = (random_next() & 0xff) * speed >> 8;
+        int dx = (sin_lut[(angle + lut_angles / 4) & (lut_angles - 1)] * amount) >> lut_sin_shift;
+        int dy = (sin_lut[angle] * amount) >> lut_sin_shift;
+        if (!particle_spawn(type, x, y, dx, dy)) {
+            return;
+        }
+    }
+}
+
+/* function to leave a skid mark under a car that is turning hard */
+void particle_skid(struct Car* car) {
+    if (car->move) {
+        particle_spawn(PARTICLE_SKID, car->x + CAR_WIDTH / 2 - 4, car->y + CAR_HEIGHT / 2 - 4, 0, 0);
+    }
+}
+
+/* function to throw out sparks and smoke where two cars hit */
+void particle_crash(struct Car* a, struct Car* b) {
+    int x = (a->x + b->x + CAR_WIDTH) / 2 - 4;
+    int y = (a->y + b->y + CAR_HEIGHT) / 2 - 4;
+    particle_burst(PARTICLE_SPARK, x, y, 16, 3 << PARTICLE_SHIFT);
+    particle_burst(PARTICLE_SMOKE, x, y, 6, 1 << (PARTICLE_SHIFT - 1));
+}
+
+/* function to move every particle, free the finished ones and put the rest on the screen,
+ * all in one pass, after the camera has moved for the frame */
+IWRAM_CODE void particle_update_all() {
+    int left = camera.x >> CAMERA_SHIFT;
+    int top = camera.y >> CAMERA_SHIFT;
+
+    /* the last frame's work decides how many particles this one can afford */
+    if (telemetry_work > PARTICLE_BUSY) {
+        particle_limit = particle_limit / 2 > PARTICLE_MIN ? particle_limit / 2 : PARTICLE_MIN;
+    } else if (telemetry_work < PARTICLE_IDLE && particle_limit < MAX_PARTICLES) {
+        particle_limit++;
+    }
+
+    for (int i = 0; i < particle_count; i++) {
+        /* a finished particle gives back its sprite and the last one moves into its place */
+        if (--particle_life[i] == 0) {
+            sprite_free(particle_sprite[i]);
+            int last = --particle_count;
+            particle_x[i] = particle_x[last];
+            particle_y[i] = particle_y[last];
+            particle_dx[i] = particle_dx[last];
+            particle_dy[i] = particle_dy[last];
+            particle_life[i] = particle_life[last];
+            particle_type[i] = particle_type[last];
+            particle_sprite[i] = particle_sprite[last];
+            i--;
+            continue;
+        }
+
+        int drag = particle_drag[particle_type[i]];
+        particle_x[i] += particle_dx[i];
+        particle_y[i] += particle_dy[i];
+        if (drag) {
+            particle_dx[i] -= particle_dx[i] >> drag;
+            particle_dy[i] -= particle_dy[i] >> drag;
+        }
+
+        int world_x = particle_x[i] >> PARTICLE_SHIFT;
+        int world_y = particle_y[i] >> PARTICLE_SHIFT;
+        int x = world_x - left;
+        int y = world_y - top;
+        if (view_affine) {
+            if (view_project_point(world_x + 4, world_y + 4, &x, &y)) {
+                x -= 4;
+                y -= 4;
+            } else {
+                x = SCREEN_WIDTH;
+            }
+        }
+        if (x <= -8 || x >= SCREEN_WIDTH || y <= -8 || y >= SCREEN_HEIGHT) {
+            sprite_hide(particle_sprite[i]);
+        } else {
+            sprite_show(particle_sprite[i]);
+            sprite_position(particle_sprite[i], x, y);
+        }
+    }
+}
+
+/* the police chasing the player, more of them coming as the wanted level goes up */
+#define MAX_POLICE 16
+#define WANTED_LEVELS 5
+const unsigned char wanted_units[WANTED_LEVELS + 1] = {0, 1, 2, 4, 8, 16};
+
+/* frames of driving it takes to raise the wanted level by one */
+#define WANTED_FRAMES 600
+
+/* the sprite frame police cars use, and where the first one starts */
+#define POLICE_FRAME 32
+#define POLICE_START_X 22
+#define POLICE_START_Y 90
+
+/* new units come in about this far from the player, just off the screen */
+#define POLICE_SPAWN_DISTANCE 160
+#define POLICE_SPAWN_TRIES 8
+
+/* how close units get before pushing apart, how hard they push, and how close to its
+ * target a unit has to be on an axis before it stops steering on it */
+#define SEPARATION_RADIUS 24
+#define SEPARATION_WEIGHT 4
+#define STEER_DEAD_ZONE 2
+
+/* the most frames ahead an intercepting unit aims for */
+#define INTERCEPT_FRAMES 48
+
+struct Car* police[MAX_POLICE];
+int police_count = 0;
+
+/* what each unit last decided: the point it is driving at and how hard it is pushing away
+ * from the others, kept between the frames it gets to think */
+int police_target_x[MAX_POLICE];
+int police_target_y[MAX_POLICE];
+short police_push_x[MAX_POLICE];
+short police_push_y[MAX_POLICE];
+
+/* units near the player think every frame, the rest take turns, a quarter of them a frame,
+ * and thinking stops for the frame once it has used its share of the cycle counter, the near
+ * units the budget cut off going first next frame */
+#define AI_BUCKETS 4
+#define AI_NEAR_DISTANCE 160
+#define AI_BUDGET (FRAME_CYCLES / 16)
+int ai_cursor = 0;
+int ai_near_cursor = 0;
+
+/* debug counters for the last frame: units that thought, units left waiting, and cycles spent */
+int ai_thinks = 0;
+int ai_skipped = 0;
+unsigned int ai_cycles = 0;
+int wanted_level = 1;
+int wanted_timer = 0;
+
+/* units are put in a grid of 64 pixel cells each frame, so separation only looks at the
+ * units in the cells around each one and the cost stays linear in the number of units */
+#define PURSUIT_CELL_SHIFT 6
+#define PURSUIT_GRID_WIDTH (WORLD_WIDTH >> PURSUIT_CELL_SHIFT)
+#define PURSUIT_GRID_HEIGHT (WORLD_HEIGHT >> PURSUIT_CELL_SHIFT)
+signed char pursuit_cells[PURSUIT_GRID_WIDTH * PURSUIT_GRID_HEIGHT];
+signed char pursuit_next[MAX_POLICE];
+short pursuit_unit_cells[MAX_POLICE];
+
+/* function to find the grid cell a unit is in */
+int pursuit_cell(struct Car* unit) {
+    int cx = (unit->x + CAR_WIDTH / 2) >> PURSUIT_CELL_SHIFT;
+    int cy = (unit->y + CAR_HEIGHT / 2) >> PURSUIT_CELL_SHIFT;
+    if (cx >= PURSUIT_GRID_WIDTH) {
+        cx = PURSUIT_GRID_WIDTH - 1;
+    }
+    if (cy >= PURSUIT_GRID_HEIGHT) {
+        cy = PURSUIT_GRID_HEIGHT - 1;
+    }
+    return cy * PURSUIT_GRID_WIDTH + cx;
+}
+
+/* function to bring in a police unit at a place, returns 0 when there is no car for it */
+int pursuit_add(int x, int y) {
+    if (police_count >= MAX_POLICE) {
+        return 0;
+    }
+    struct Car* unit = car_spawn(x, y, POLICE_FRAME);
+    if (!unit) {
+        return 0;
+    }
+
+    /* half the units go across on even frames and half on odd ones, and until a unit
+     * first thinks it stays where it is */
+    unit->counter = police_count & 1;
+    police_target_x[police_count] = x;
+    police_target_y[police_count] = y;
+    police_push_x[police_count] = 0;
+    police_push_y[police_count] = 0;
+    police[police_count++] = unit;
+    return 1;
+}
+
+/* function to bring in a police unit somewhere clear around the player, just off the screen */
+int pursuit_spawn(struct Car* player) {
+    for (int i = 0; i < POLICE_SPAWN_TRIES; i++) {
+        int angle = random_next() & (lut_angles - 1);
+        int x = player->x + ((sin_lut[(angle + lut_angles / 4) & (lut_angles - 1)] * POLICE_SPAWN_DISTANCE) >> lut_sin_shift);
+        int y = player->y + ((sin_lut[angle] * POLICE_SPAWN_DISTANCE) >> lut_sin_shift);
+        if (!(collision_box(x, y, CAR_WIDTH, CAR_HEIGHT) & CAR_BLOCKED)) {
+            return pursuit_add(x, y);
+        }
+    }
+    return 0;
+}
+
+/* function to take every unit away and start the chase again from the lowest wanted level */
+void pursuit_reset() {
+    for (int i = 0; i < police_count; i++) {
+        car_despawn(police[i]);
+    }
+    police_count = 0;
+    ai_cursor = 0;
+    ai_near_cursor = 0;
+    wanted_level = 1;
+    wanted_timer = 0;
+    pursuit_add(POLICE_START_X, POLICE_START_Y);
+}
+
+/* function to set up the pursuit with one unit at the start */
+void pursuit_init() {
+    for (int i = 0; i < PURSUIT_GRID_WIDTH * PURSUIT_GRID_HEIGHT; i++) {
+        pursuit_cells[i] = -1;
+    }
+    police_count = 0;
+    pursuit_reset();
+}
+
+/* function to get the size of a number */
+int magnitude(int value) {
+    return value < 0 ? -value : value;
+}
+
+/* function for a unit to decide where to go: even units seek where the player is, odd ones
+ * intercept where the player is heading, and all of them push away from units too close */
+void pursuit_think(int i, struct Car* player) {
+    struct Car* unit = police[i];
+    int target_x = player->x;
+    int target_y = player->y;
+
+    /* intercepting aims further ahead of the player the further away it is */
+    if (i & 1) {
+        int frames = (magnitude(player->x - unit->x) + magnitude(player->y - unit->y)) / 2;
+        if (frames > INTERCEPT_FRAMES) {
+            frames = INTERCEPT_FRAMES;
+        }
+        target_x += player->dx * frames;
+        target_y += player->dy * frames;
+    }
+    police_target_x[i] = target_x;
+    police_target_y[i] = target_y;
+
+    /* separation from the units in this cell and the ones around it */
+    int push_x = 0;
+    int push_y = 0;
+    int cell = pursuit_unit_cells[i];
+    int cx = cell % PURSUIT_GRID_WIDTH;
+    int cy = cell / PURSUIT_GRID_WIDTH;
+    for (int y = cy - 1; y <= cy + 1; y++) {
+        for (int x = cx - 1; x <= cx + 1; x++) {
+            if (x < 0 || y < 0 || x >= PURSUIT_GRID_WIDTH || y >= PURSUIT_GRID_HEIGHT) {
+                continue;
+            }
+            for (int j = pursuit_cells[y * PURSUIT_GRID_WIDTH + x]; j >= 0; j = pursuit_next[j]) {
+                int away_x = unit->x - police[j]->x;
+                int away_y = unit->y - police[j]->y;
+                if (j == i || magnitude(away_x) >= SEPARATION_RADIUS || magnitude(away_y) >= SEPARATION_RADIUS) {
+                    continue;
+                }
+                push_x += (away_x < 0 ? -1 : 1) * (SEPARATION_RADIUS - magnitude(away_x)) * SEPARATION_WEIGHT;
+                push_y += (away_y < 0 ? -1 : 1) * (SEPARATION_RADIUS - magnitude(away_y)) * SEPARATION_WEIGHT;
+            }
+        }
+    }
+    police_push_x[i] = push_x;
+    police_push_y[i] = push_y;
+}
+
+/* function to move a unit towards what it last decided, with the same code the player's car uses,
+ * or in a few big steps when it is culled */
+void pursuit_act(int i) {
+    struct Car* unit = police[i];
+    int steer_x = police_target_x[i] - unit->x + police_push_x[i];
+    int steer_y = police_target_y[i] - unit->y + police_push_y[i];
+
+    /* a culled unit covers the same ground at the same speeds, going across at half speed,
+     * on one frame in CULL_RATE, with the units spread out over those frames */
+    if (!unit->visible) {
+        if ((frame_count + i) % CULL_RATE == 0) {
+            int sx = steer_x < -STEER_DEAD_ZONE ? -1 : steer_x > STEER_DEAD_ZONE;
+            int sy = steer_y < -STEER_DEAD_ZONE ? -1 : steer_y > STEER_DEAD_ZONE;
+            unit->dx = sx;
+            unit->dy = sy;
+            unit->move = sx || sy;
+            car_move(unit, sx * CULL_RATE / 2, sy * CULL_RATE);
+        }
+        return;
+    }
+
+    /* units go across every other frame, so the player can outrun them */
+    unit->counter ^= 1;
+    unit->dx = 0;
+    unit->dy = 0;
+    unit->move = 0;
+    if (unit->counter) {
+        if (steer_x < -STEER_DEAD_ZONE) {
+            car_left(unit);
+        } else if (steer_x > STEER_DEAD_ZONE) {
+            car_right(unit);
+        }
+    }
+    if (steer_y < -STEER_DEAD_ZONE) {
+        car_up(unit);
+    } else if (steer_y > STEER_DEAD_ZONE) {
+        car_down(unit);
+    }
+}
+
+/* function to pick which units think this frame: the ones near the player first, then the
+ * next bucket of the far ones in turn, stopping when the frame's ai budget is used up */
+void ai_schedule(struct Car* player) {
+    unsigned int start = cycles();
+    int far_count = 0;
+    int near_start = ai_near_cursor;
+    ai_thinks = 0;
+    ai_skipped = 0;
+
+    /* the near units are gone through from the first one the budget cut off last frame */
+    for (int n = 0; n < police_count; n++) {
+        int i = near_start + n < police_count ? near_start + n : near_start + n - police_count;
+        struct Car* unit = police[i];
+        if (magnitude(player->x - unit->x) + magnitude(player->y - unit->y) >= AI_NEAR_DISTANCE) {
+            far_count++;
+            continue;
+        }
+        /* at least one unit thinks each frame, however far over budget it is */
+        if (ai_thinks > 0 && cycles() - start > AI_BUDGET) {
+            if (ai_skipped == 0) {
+                ai_near_cursor = i;
+            }
+            ai_skipped++;
+            continue;
+        }
+        pursuit_think(i, player);
+        ai_thinks++;
+    }
+
+    /* the far units are gone through in turn from where the last frame stopped */
+    int turn = (far_count + AI_BUCKETS - 1) / AI_BUCKETS;
+    for (int n = 0; n < police_count && turn > 0; n++) {
+        int i = ai_cursor;
+        ai_cursor = ai_cursor + 1 < police_count ? ai_cursor + 1 : 0;
+        struct Car* unit = police[i];
+        if (magnitude(player->x - unit->x) + magnitude(player->y - unit->y) < AI_NEAR_DISTANCE) {
+            continue;
+        }
+        if (ai_thinks > 0 && cycles() - start > AI_BUDGET) {
+            /* leave the cursor on this unit so it goes first next frame */
+            ai_cursor = i;
+            ai_skipped += turn;
+            break;
+        }
+        pursuit_think(i, player);
+        ai_thinks++;
+        turn--;
+    }
+    ai_cycles = cycles() - start;
+}
+
+/* function to run the chase for a frame: bring in units as the wanted level goes up, let the
+ * scheduler pick which units think, and move all of them */
+void pursuit_update(struct Car* player) {
+    /* driving around raises the wanted level, and a new unit comes in each frame until there are enough */
+    if (player->move && wanted_level < WANTED_LEVELS && ++wanted_timer >= WANTED_FRAMES) {
+        wanted_level++;
+        wanted_timer = 0;
+    }
+    if (police_count < wanted_units[wanted_level]) {
+        pursuit_spawn(player);
+    }
+    if (ai_cursor >= police_count) {
+        ai_cursor = 0;
+    }
+    if (ai_near_cursor >= police_count) {
+        ai_near_cursor = 0;
+    }
+
+    for (int i = 0; i < police_count; i++) {
+        int cell = pursuit_cell(police[i]);
+        pursuit_unit_cells[i] = cell;
+        pursuit_next[i] = pursuit_cells[cell];
+        pursuit_cells[cell] = i;
+    }
+
+    ai_schedule(player);
+    for (int i = 0; i < police_count; i++) {
+        pursuit_act(i);
+    }
+
+    /* the units have moved, so the cells are cleared from where they were put */
+    for (int i = 0; i < police_count; i++) {
+        pursuit_cells[pursuit_unit_cells[i]] = -1;
+    }
+}
+
+/* function to follow the player's car with the engine and the nearest unit with the siren */
+void sound_update(struct Car* player) {
+    sound_set(engine_channel, player->move ? ENGINE_RATE * 2 : ENGINE_RATE, ENGINE_VOLUME, 32);
+
+    /* find the nearest unit */
+    struct Car* nearest = 0;
+    int distance = SIREN_RANGE;
+    for (int i = 0; i < police_count; i++) {
+        int d = magnitude(police[i]->x - player->x) + magnitude(police[i]->y - player->y);
+        if (d < distance) {
+            distance = d;
+            nearest = police[i];
+        }
+    }
+
+    if (!nearest) {
+        sound_stop(siren_channel);
+        siren_channel = -1;
+        return;
+    }
+    if (siren_channel < 0) {
+        siren_channel = sound_play(sound_siren, sound_siren_length, SIREN_RATE, 0, 32, 1);
+        if (siren_channel < 0) {
+            return;
+        }
+    }
+
+    /* the pitch swings up and down about once a second */
+    int wail = sin_lut[(frame_count * 4) & (lut_angles - 1)];
+    int rate = SIREN_RATE + ((SIREN_RATE / 4 * wail) >> lut_sin_shift);
+    int volume = SIREN_VOLUME * (SIREN_RANGE - distance) / SIREN_RANGE;
+    int pan = 32 + (nearest->x - player->x) / 4;
+    if (pan < 0) {
+        pan = 0;
+    } else if (pan > 64) {
+        pan = 64;
+    }
+    sound_set(siren_channel, rate, volume, pan);
+}
+
+#ifdef PURSUIT_BENCHMARK
+/* function to time the pursuit and putting the cars on the screen with 4, 8 and 16 units,
+ * showing the average cycles a frame and the share of a frame on the text layer
+ * no run of it has been recorded yet, the figures so far are estimates counted from the
+ * instruction timings for thumb code in rom: about 4.5k, 9.5k and 20k cycles, or 1.6%, 3.4%
+ * and 7.1% of a frame */
+void set_text(char* str, int row, int col);
+void pursuit_benchmark(struct Car* player) {
+    const int sizes[3] = {4, 8, 16};
+    char line[32];
+
+    for (int i = 0; i < 3; i++) {
+        pursuit_reset();
+        for (int tries = 0; police_count < sizes[i] && tries < 64; tries++) {
+            pursuit_spawn(player);
+        }
+        wanted_level = WANTED_LEVELS;
+
+        unsigned int total = 0;
+        for (int frame = 0; frame < 64; frame++) {
+            unsigned int start = cycles();
+            pursuit_update(player);
+            camera_project_all();
+            total += cycles() - start;
+        }
+        total /= 64;
+        sprintf(line, "%2d units %6u %2u.%u%%", police_count, total,
+            total * 100 / FRAME_CYCLES, total * 1000 / FRAME_CYCLES % 10);
+        set_text(line, 2 + i, 0);
+    }
+    pursuit_reset();
+}
+#endif
+
+/* the minimap is the whole world at a pixel per metatile, drawn once into tiles after the font
+ * in char block 1 and shown in the top right corner of the text layer */
+#define MINIMAP_WIDTH WORLD_METATILES_WIDTH
+#define MINIMAP_HEIGHT WORLD_METATILES_HEIGHT
+#define MINIMAP_COLUMNS (MINIMAP_WIDTH / 8)
+#define MINIMAP_ROWS (MINIMAP_HEIGHT / 8)
+#define MINIMAP_TILE font_glyphs
+#define MINIMAP_COLUMN (SCREEN_WIDTH / 8 - MINIMAP_COLUMNS)
+#define MINIMAP_X (MINIMAP_COLUMN * 8)
+_Static_assert(MINIMAP_WIDTH % 8 == 0 && MINIMAP_HEIGHT % 8 == 0, "the minimap is not a whole number of tiles");
+_Static_assert((MINIMAP_TILE + MINIMAP_COLUMNS * MINIMAP_ROWS) * 64 <= 0x4000, "the minimap overflows char block 1");
+
+/* the background color for each collision class: dark grey roads, light grey sidewalks,
+ * green for anything solid and blue water */
+const unsigned char minimap_colors[4] = {2, 7, 11, 12};
+
+/* blips are sprites, a dot for the player, the police and any other car */
+#define BLIP_PLAYER 0
+#define BLIP_POLICE 1
+#define BLIP_OTHER 2
+#define BLIP_TYPES 3
+_Static_assert(BLIP_TYPES * 2 == BLIP_TILES, "vram.h has the wrong number of blip tiles");
+const unsigned char blip_shape[8] = {0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+const unsigned char blip_colors[BLIP_TYPES] = {5, 2, STEADY_GREY};
+
+/* a blip for each place in the car list, taken from the sprite pool as they are needed */
+struct Sprite* minimap_blips[MAX_CARS];
+int minimap_blip_count = 0;
+
+/* function to draw the minimap tiles and put them on the text layer */
+void minimap_init() {
+    volatile unsigned short* tiles = char_block(1) + MINIMAP_TILE * 32;
+    volatile unsigned short* map = screen_block(TEXT_SCREEN_BLOCK);
+
+    /* vram takes halfwords, so the pixels are done in pairs */
+    for (int my = 0; my < MINIMAP_HEIGHT; my++) {
+        for (int mx = 0; mx < MINIMAP_WIDTH; mx += 2) {
+            int left = collision_point(mx * METATILE_SIZE + METATILE_SIZE / 2, my * METATILE_SIZE + METATILE_SIZE / 2);
+            int right = collision_point((mx + 1) * METATILE_SIZE + METATILE_SIZE / 2, my * METATILE_SIZE + METATILE_SIZE / 2);
+            int tile = (my / 8) * MINIMAP_COLUMNS + mx / 8;
+            tiles[tile * 32 + (my % 8) * 4 + (mx % 8) / 2] = minimap_colors[left] | (minimap_colors[right] << 8);
+        }
+    }
+    for (int row = 0; row < MINIMAP_ROWS; row++) {
+        for (int column = 0; column < MINIMAP_COLUMNS; column++) {
+            map[row * 32 + MINIMAP_COLUMN + column] = MINIMAP_TILE + row * MINIMAP_COLUMNS + column;
+        }
+    }
+
+    for (int type = 0; type < BLIP_TYPES; type++) {
+        sprite_draw_shape(BLIP_TILE + type * 2, blip_shape, blip_colors[type]);
+    }
+    minimap_blip_count = 0;
+}
+
+/* function to move the blips to where the cars are, which only touches their oam entries */
+void minimap_update(struct Car* player) {
+    for (int i = 0; i < num_cars; i++) {
+        if (i == minimap_blip_count) {
+            struct Sprite* blip = sprite_init(SCREEN_WIDTH, SCREEN_HEIGHT, SIZE_8_8, 0, 0, BLIP_TILE, 0);
+            if (!blip) {
+                break;
+            }
+            minimap_blips[minimap_blip_count++] = blip;
+        }
+
+        struct Car* car = cars[i];
+        int type = car == player ? BLIP_PLAYER : car->frame == POLICE_FRAME ? BLIP_POLICE : BLIP_OTHER;
+        sprite_set_offset(minimap_blips[i], BLIP_TILE + type * 2);
+        sprite_show(minimap_blips[i]);
+        sprite_position(minimap_blips[i], MINIMAP_X + (car->x + CAR_WIDTH / 2) / METATILE_SIZE,
+            (car->y + CAR_HEIGHT / 2) / METATILE_SIZE);
+    }
+
+    /* blips left over from cars that have gone are hidden until they are needed again */
+    for (int i = num_cars; i < minimap_blip_count; i++) {
+        sprite_hide(minimap_blips[i]);
     }
 }
 
@@ -416,18 +3177,35 @@ void reset(int* num_lives);
 
 /* function to check for collisions and change lives accordingly */
 void collision(struct Car* policecar, struct Car* currentcar, int* num_lives){
-    policecar->x = 45;
+    int lives = *num_lives;
+
+    /* the last life going fades out before the cars are put back, other crashes just flash */
+    if (lives == 0) {
+        fade_out();
+        fade_wait();
+        /* the frames spent fading out are not a slow frame */
+        telemetry_skip();
+        fade_in();
+    } else {
+        fade_flash();
+    }
+
+    particle_crash(policecar, currentcar);
+    sound_play(sound_crash, sound_crash_length, sound_rate, CRASH_VOLUME, 32, 0);
+
+    /* getting caught ends the chase, and it starts again from one unit */
     currentcar->x = 100;
-    policecar->y = 90;
     currentcar->y = 90;
+    camera_snap(currentcar);
+    pursuit_reset();
 
     subtract(num_lives);
     reset(num_lives);     
 }
 
-/* function to check if the police car and player car are actually colliding */
-void check(struct Car* policecar, struct Car* currentcar, int* lives){
-    int policex = policecar->x/2;
+/* function to check if the police car and player car are actually colliding, returns 1 if they are */
+int check(struct Car* policecar, struct Car* currentcar, int* lives){
+    int policex = policecar->x;
     int policey = policecar->y;
     int currentx = currentcar->x;
     int currenty = currentcar->y;
@@ -443,84 +3221,190 @@ void check(struct Car* policecar, struct Car* currentcar, int* lives){
     }
     else if(((currentx+32) == policex) & (((currenty-16)<=policey) & (policey<=currenty))){
         collision(policecar, currentcar, lives);
-    }    
+    }
+    else {
+        return 0;
+    }
+    return 1;
+}
+
+/* function to check the player against every police unit, stopping at the first crash
+ * since it puts all of them back */
+void pursuit_check(struct Car* currentcar, int* lives) {
+    for (int i = 0; i < police_count; i++) {
+        if (check(police[i], currentcar, lives)) {
+            return;
+        }
+    }
 }
 
 /* function to put text on the screen */
 void set_text(char* str, int row, int col) {                    
     int index = row * 32 + col;
-    int missing = 32; 
-    volatile unsigned short* ptr = screen_block(24);
+    volatile unsigned short* ptr = screen_block(TEXT_SCREEN_BLOCK);
     while (*str) {
-        ptr[index] = *str - missing;
+        ptr[index] = font_glyph_index[(unsigned char) *str];
         index++;
         str++;
     }   
 }
 
+/* function to pause the game, sleeping until start is pressed again */
+void pause_game() {
+    set_text("Paused", 1, 0);
+    sound_clear();
+
+    /* select while paused saves the telemetry to sram */
+    while (1) {
+        /* let go of start and select first, or the press that paused would unpause at once, and
+         * the keypad interrupt would keep firing while a key is held instead of halting */
+        while (button_held(BUTTON_START | BUTTON_SELECT)) {
+            wait_next_vblank();
+            input_poll();
+        }
+        input_wait(BUTTON_START | BUTTON_SELECT);
+
+        /* polling here also latches the unpausing press so it is not seen as a new one next frame */
+        input_poll();
+        if (button_pressed(BUTTON_START)) {
+            break;
+        }
+        if (button_pressed(BUTTON_SELECT)) {
+            telemetry_save();
+            set_text("Saved ", 1, 0);
+        }
+    }
+
+    /* the paused time is not a slow frame */
+    telemetry_skip();
+    set_text("      ", 1, 0);
+}
+
 /* function to delay the background scrolling */
 void delay(unsigned int amount) {
     for (int i = 0; i < amount * 10; i++);
 }
 
 int main() {
-    *display_control = MODE0 | BG0_ENABLE | BG1_ENABLE | SPRITE_ENABLE | SPRITE_MAP_1D;    
+    *display_control = DISPLAY_NORMAL;
+
+    interrupt_init();
+    mpx_init();
+    timer_init();
+    sound_init();
 
+    copy_calibrate();
     setup_background();
     
     int lives = 3;
-    char slives[12];
+    char slives[32];
 
     setup_sprite_image();
     sprite_clear();
-
-    struct Car redcar;
-    car_init(&redcar, 90, 90, 0);
-    struct Car greencar;
-    car_init(&greencar, 90, 25, 16);
-    struct Car policecar;
-    car_init(&policecar, 10, 90, 32);
-    struct Car *currentcar = &redcar;
-
-    int xscroll = 0;
+    palette_effects_init();
+    particle_init();
+
+    car_pool_init();
+    struct Car* redcar = car_spawn(90, 90, 0);
+    struct Car* greencar = car_spawn(90, 25, 16);
+    struct Car *currentcar = redcar;
+    camera_snap(currentcar);
+    map_load();
+    pursuit_init();
+    minimap_init();
+#ifdef PURSUIT_BENCHMARK
+    pursuit_benchmark(currentcar);
+#endif
+#ifdef SOUND_BENCHMARK
+    sound_benchmark();
+#endif
+    engine_channel = sound_play(sound_engine, sound_engine_length, ENGINE_RATE, ENGINE_VOLUME, 32, 1);
 
     while (1) {
-        car_update(&redcar);
-        car_update(&greencar);
-        policecar_update(&policecar);
-        check(&policecar, currentcar, &lives);
-        sprintf(slives, "Lives: %d", lives);
+        telemetry_frame(num_cars);
+        pursuit_check(currentcar, &lives);
+        sprintf(slives, "Lives: %d  Wanted: %d", lives, wanted_level);
         set_text(slives, 0,0);
 
+        input_poll();
+        if (button_pressed(BUTTON_START)) {
+            pause_game();
+        }
+
+        if (button_pressed(BUTTON_SELECT)) {
+            night = !night;
+        }
+
+        /* r switches to the rotating view, and l tilts it into perspective */
+        if (button_pressed(BUTTON_R)) {
+            view_set(!view_affine);
+        }
+        if (button_pressed(BUTTON_L)) {
+            view_perspective = !view_perspective;
+        }
+
         if(button_pressed(BUTTON_A)){
-            currentcar = &greencar;
+            currentcar = greencar;
             currentcar->frame = 16;
         }
         else if(button_pressed(BUTTON_B)){
-            currentcar = &redcar;
+            currentcar = redcar;
             currentcar->frame = 0;
-        }        
-        if (button_pressed(BUTTON_RIGHT)) {
-            if (car_right(currentcar)) {
-                xscroll++;
-            }
-        } else if (button_pressed(BUTTON_LEFT)) {
-            if (car_left(currentcar)) {
-                xscroll--;
-            }
-        } else if (button_pressed(BUTTON_UP)) {
+        }
+
+        /* horizontal and vertical are checked separately so diagonals work */
+        int moving = 0;
+        if (button_held(BUTTON_RIGHT)) {
+            moving = 1;
+            car_right(currentcar);
+        } else if (button_held(BUTTON_LEFT)) {
+            moving = 1;
+            car_left(currentcar);
+        } else {
+            currentcar->dx = 0;
+        }
+        if (button_held(BUTTON_UP)) {
+            moving = 1;
             car_up(currentcar);
-        } else if (button_pressed(BUTTON_DOWN)) { 
+        } else if (button_held(BUTTON_DOWN)) {
+            moving = 1;
             car_down(currentcar);
         } else {
+            currentcar->dy = 0;
+        }
+        if (!moving) {
             car_stop(currentcar);
         }
 
-        move_police(&policecar, currentcar); 
+        cull_all();
+        pursuit_update(currentcar);
+        sound_update(currentcar);
+
+        for (int i = 0; i < num_cars; i++) {
+            if (car_turn(cars[i])) {
+                particle_skid(cars[i]);
+            }
+        }
+
+        camera_follow(currentcar);
+        if (view_affine) {
+            view_update(currentcar);
+        }
+        camera_project_all();
+        particle_update_all();
+        minimap_update(currentcar);
+        tiles_animate();
 
+        telemetry_work_done();
         wait_vblank();
-        *bg0_x_scroll = xscroll;
+        camera_apply();
+        view_apply();
+        map_stream();
+        tiles_flush();
+        palette_effects_update();
         sprite_update_all();
+        fade_update();
+        sound_mix();
 
         delay(100);
     }
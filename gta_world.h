@@ -0,0 +1,174 @@
+/* gta_world.h
+ * generated by mapconv from gta_map.h
+ * 784 bytes, the same world as a flat tile map would be 16384 bytes */
+
+#define metatile_count 62
+#define chunk_size 8
+#define chunk_count 4
+#define world_chunks_width 8
+#define world_chunks_height 4
+#define collision_words_per_row 8
+
+/* the four tile map entries of each metatile: top left, top right, bottom left, bottom right */
+const unsigned short metatiles [] = {
+    0x0007, 0x0008, 0x0012, 0x0013, 0x0012, 0x0013, 0x0001, 0x000d, 0x0012, 
+    0x0013, 0x000c, 0x0001, 0x0012, 0x0013, 0x000c, 0x000d, 0x0012, 0x0013, 
+    0x000c, 0x000c, 0x0001, 0x0001, 0x0001, 0x000f, 0x0001, 0x0001, 0x000e, 
+    0x000f, 0x0001, 0x0002, 0x000e, 0x000f, 0x0001, 0x0001, 0x0002, 0x0001, 
+    0x0002, 0x0001, 0x0001, 0x000f, 0x0001, 0x0002, 0x000c, 0x0001, 0x0001, 
+    0x0002, 0x0001, 0x000d, 0x0001, 0x0002, 0x000c, 0x000d, 0x000c, 0x0002, 
+    0x0001, 0x0002, 0x0005, 0x0006, 0x0010, 0x0011, 0x0001, 0x0001, 0x000c, 
+    0x0002, 0x0002, 0x000c, 0x0001, 0x000d, 0x0002, 0x000c, 0x0002, 0x0001, 
+    0x0001, 0x000c, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x000c, 
+    0x000c, 0x0001, 0x0002, 0x0001, 0x000d, 0x0001, 0x000c, 0x0002, 0x0002, 
+    0x0002, 0x0001, 0x0001, 0x000c, 0x000c, 0x0001, 0x0001, 0x0002, 0x000c, 
+    0x000c, 0x0002, 0x000c, 0x000c, 0x000d, 0x0002, 0x000c, 0x0001, 0x000c, 
+    0x000d, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0001, 0x000d, 0x000c, 
+    0x000d, 0x0001, 0x0002, 0x0002, 0x000c, 0x0007, 0x0008, 0x0002, 0x0001, 
+    0x0007, 0x0008, 0x000c, 0x000c, 0x0007, 0x0008, 0x000c, 0x0002, 0x0007, 
+    0x0008, 0x0001, 0x0001, 0x0007, 0x0008, 0x0001, 0x0002, 0x0007, 0x0008, 
+    0x0001, 0x000d, 0x0007, 0x0008, 0x0001, 0x0002, 0x0001, 0x000f, 0x0001, 
+    0x0002, 0x000e, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0001, 
+    0x000e, 0x000f, 0x0002, 0x0002, 0x000c, 0x000d, 0x000c, 0x0002, 0x0002, 
+    0x000d, 0x0002, 0x0002, 0x0001, 0x0001, 0x000c, 0x0001, 0x0002, 0x000d, 
+    0x000d, 0x0002, 0x000c, 0x0002, 0x0002, 0x0002, 0x000d, 0x0001, 0x0002, 
+    0x0002, 0x0002, 0x000c, 0x0002, 0x0002, 0x0002, 0x000d, 0x000c, 0x000d, 
+    0x0002, 0x0002, 0x0002, 0x000c, 0x000c, 0x0001, 0x0001, 0x000c, 0x0001, 
+    0x000c, 0x0001, 0x0001, 0x0001, 0x000c, 0x000c, 0x0002, 0x0002, 0x0001, 
+    0x0002, 0x000d, 0x0001, 0x0002, 0x0002, 0x0001, 0x0002, 0x0001, 0x000d, 
+    0x0002, 0x0002, 0x000c, 0x000d, 0x0001, 0x0007, 0x0008, 0x000c, 0x000d, 
+    0x0007, 0x0008, 0x0002, 0x0002, 0x0007, 0x0008, 0x0000, 0x0000, 0x0000, 
+    0x0000, 0x0000, 0x0035, 0x0000, 0x0000
+};
+
+/* the metatile at each place in each chunk, row by row */
+const unsigned char chunks [] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
+    0x01, 0x02, 0x03, 0x01, 0x03, 0x04, 0x01, 0x05, 0x06, 
+    0x07, 0x06, 0x08, 0x06, 0x06, 0x09, 0x0a, 0x0b, 0x0b, 
+    0x0c, 0x0b, 0x0c, 0x0d, 0x0a, 0x0e, 0x0e, 0x0e, 0x0e, 
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 
+    0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 
+    0x13, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x1e, 
+    0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x02, 0x03, 0x03, 0x02, 0x03, 0x02, 0x03, 0x03, 0x06, 
+    0x06, 0x25, 0x06, 0x26, 0x06, 0x27, 0x28, 0x0c, 0x0c, 
+    0x0b, 0x1c, 0x0c, 0x29, 0x0a, 0x0c, 0x0e, 0x0e, 0x0e, 
+    0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0x2a, 0x2b, 0x2c, 0x2d, 
+    0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34, 0x2b, 0x35, 
+    0x36, 0x37, 0x38, 0x39, 0x3a, 0x22, 0x22, 0x23, 0x3b, 
+    0x21, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3d, 
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
+    0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 
+    0x3c, 0x3c, 0x3c, 0x3c
+};
+
+/* the chunk at each place in the world, row by row */
+const unsigned char world_chunks [] = {
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 
+    0x03, 0x02, 0x03, 0x02, 0x03, 0x02, 0x03, 0x00, 0x01, 
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x03, 0x02, 
+    0x03, 0x02, 0x03, 0x02, 0x03
+};
+
+/* the collision class of each world tile, 2 bits each and 16 to a word, row by row */
+const unsigned int collision_map [] = {
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xfffffffb, 0xffffffff, 0xfffffffb, 0xffffffff, 
+    0xfffffffb, 0xffffffff, 0xfffffffb, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 0x55555555, 
+    0x55555555, 0x55555555, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xfffffffb, 0xffffffff, 0xfffffffb, 0xffffffff, 0xfffffffb, 0xffffffff, 
+    0xfffffffb, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 
+    0xffffffff, 0xffffffff
+};
+
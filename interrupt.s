@@ -0,0 +1,128 @@
+/* interrupt dispatcher, placed in iwram and assembled as arm code */
+.section .iwram, "ax", %progbits
+.arm
+.align 2
+
+.global interrupt_dispatch
+.type interrupt_dispatch, %function
+
+/* function the bios calls on every interrupt, in irq mode with r0-r3, r12 and lr saved
+ * every pending interrupt is acknowledged, then their handlers run from the lowest bit up, so
+ * vblank goes first; a handler with a mask in interrupt_masks runs in system mode with
+ * interrupts on but only the ones in its mask enabled, so just those can interrupt it
+ * interrupt_stats is laid out like struct InterruptStats in gta.c: count, total cycles, most
+ * cycles and most latency, 16 bytes each, with the latency counted from entering here */
+interrupt_dispatch:
+    stmfd sp!, {r4-r8, lr}
+    /* r4 = the interrupt registers, r8 = the time on entry, from the low half of the cycle counter */
+    mov r4, #0x4000000
+    ldrh r8, [r4, #0x108]
+    add r4, r4, #0x200
+    /* r5 = interrupts both enabled and pending, loading enable and flags together */
+    ldr r5, [r4]
+    and r5, r5, r5, lsr #16
+    /* acknowledge them to the hardware, and to the bios for its interrupt waits */
+    strh r5, [r4, #2]
+    ldr r0, =0x3007ff8
+    ldrh r1, [r0]
+    orr r1, r1, r5
+    strh r1, [r0]
+    /* r6 = the interrupt number */
+    mov r6, #0
+dispatch_next:
+    /* if there are none left, go to dispatch_done: */
+    cmp r5, #0
+    beq dispatch_done
+    /* if this one is not pending or has no handler, go to dispatch_skip: */
+    tst r5, #1
+    beq dispatch_skip
+    ldr r0, =interrupt_handlers
+    ldr r7, [r0, r6, lsl #2]
+    cmp r7, #0
+    beq dispatch_skip
+
+    /* r0 = the time the handler starts, kept on the stack, and r1 = the latency */
+    ldrh r0, [r4, #-0xf8]
+    stmfd sp!, {r0}
+    sub r1, r0, r8
+    mov r1, r1, lsl #16
+    mov r1, r1, lsr #16
+    /* r2 = this interrupt's stats, and keep the most latency */
+    ldr r2, =interrupt_stats
+    add r2, r2, r6, lsl #4
+    ldr r3, [r2, #12]
+    cmp r1, r3
+    strhi r1, [r2, #12]
+
+    /* r1 = the interrupts this handler lets in, and if there are any, go to dispatch_nested: */
+    ldr r0, =interrupt_masks
+    add r0, r0, r6, lsl #1
+    ldrh r1, [r0]
+    cmp r1, #0
+    bne dispatch_nested
+    /* else call the handler in irq mode with interrupts off */
+    mov lr, pc
+    bx r7
+    b dispatch_stats
+
+dispatch_nested:
+    /* enable only the interrupts in the mask, saving the ones this masks off and the spsr,
+     * which a nested interrupt would overwrite */
+    ldrh r2, [r4]
+    and r1, r1, r2
+    bic r2, r2, r1
+    strh r1, [r4]
+    mrs r3, spsr
+    stmfd sp!, {r2, r3}
+    /* switch to system mode with interrupts on, and call the handler there */
+    mrs r3, cpsr
+    bic r3, r3, #0xdf
+    orr r3, r3, #0x1f
+    msr cpsr_c, r3
+    stmfd sp!, {lr}
+    mov lr, pc
+    bx r7
+    ldmfd sp!, {lr}
+    /* back to irq mode with interrupts off, put back the spsr, and enable again the interrupts
+     * that were masked off, keeping whatever the handler changed in the rest */
+    mrs r3, cpsr
+    bic r3, r3, #0xdf
+    orr r3, r3, #0x92
+    msr cpsr_c, r3
+    ldmfd sp!, {r2, r3}
+    msr spsr_fsxc, r3
+    ldrh r1, [r4]
+    orr r1, r1, r2
+    strh r1, [r4]
+
+dispatch_stats:
+    /* r1 = the cycles the handler took */
+    ldmfd sp!, {r0}
+    ldrh r1, [r4, #-0xf8]
+    sub r1, r1, r0
+    mov r1, r1, lsl #16
+    mov r1, r1, lsr #16
+    /* count it, add up its cycles and keep the most */
+    ldr r2, =interrupt_stats
+    add r2, r2, r6, lsl #4
+    ldr r3, [r2]
+    add r3, r3, #1
+    str r3, [r2]
+    ldr r3, [r2, #4]
+    add r3, r3, r1
+    str r3, [r2, #4]
+    ldr r3, [r2, #8]
+    cmp r1, r3
+    strhi r1, [r2, #8]
+
+dispatch_skip:
+    /* move on to the next interrupt */
+    mov r5, r5, lsr #1
+    add r6, r6, #1
+    b dispatch_next
+dispatch_done:
+    /* restore the registers and return to the bios */
+    ldmfd sp!, {r4-r8, lr}
+    bx lr
+
+.ltorg
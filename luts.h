@@ -0,0 +1,100 @@
+/* luts.h
+ * generated by lutgen */
+
+#define lut_angles 256
+#define lut_sin_shift 12
+#define lut_reciprocals 512
+
+/* sine of each angle, the cosine is the sine a quarter turn on */
+const short sin_lut [] = {
+    0, 101, 201, 301, 401, 501, 601, 700, 799, 
+    897, 995, 1092, 1189, 1285, 1380, 1474, 1567, 1660, 
+    1751, 1842, 1931, 2019, 2106, 2191, 2276, 2359, 2440, 
+    2520, 2598, 2675, 2751, 2824, 2896, 2967, 3035, 3102, 
+    3166, 3229, 3290, 3349, 3406, 3461, 3513, 3564, 3612, 
+    3659, 3703, 3745, 3784, 3822, 3857, 3889, 3920, 3948, 
+    3973, 3996, 4017, 4036, 4052, 4065, 4076, 4085, 4091, 
+    4095, 4096, 4095, 4091, 4085, 4076, 4065, 4052, 4036, 
+    4017, 3996, 3973, 3948, 3920, 3889, 3857, 3822, 3784, 
+    3745, 3703, 3659, 3612, 3564, 3513, 3461, 3406, 3349, 
+    3290, 3229, 3166, 3102, 3035, 2967, 2896, 2824, 2751, 
+    2675, 2598, 2520, 2440, 2359, 2276, 2191, 2106, 2019, 
+    1931, 1842, 1751, 1660, 1567, 1474, 1380, 1285, 1189, 
+    1092, 995, 897, 799, 700, 601, 501, 401, 301, 
+    201, 101, 0, -101, -201, -301, -401, -501, -601, 
+    -700, -799, -897, -995, -1092, -1189, -1285, -1380, -1474, 
+    -1567, -1660, -1751, -1842, -1931, -2019, -2106, -2191, -2276, 
+    -2359, -2440, -2520, -2598, -2675, -2751, -2824, -2896, -2967, 
+    -3035, -3102, -3166, -3229, -3290, -3349, -3406, -3461, -3513, 
+    -3564, -3612, -3659, -3703, -3745, -3784, -3822, -3857, -3889, 
+    -3920, -3948, -3973, -3996, -4017, -4036, -4052, -4065, -4076, 
+    -4085, -4091, -4095, -4096, -4095, -4091, -4085, -4076, -4065, 
+    -4052, -4036, -4017, -3996, -3973, -3948, -3920, -3889, -3857, 
+    -3822, -3784, -3745, -3703, -3659, -3612, -3564, -3513, -3461, 
+    -3406, -3349, -3290, -3229, -3166, -3102, -3035, -2967, -2896, 
+    -2824, -2751, -2675, -2598, -2520, -2440, -2359, -2276, -2191, 
+    -2106, -2019, -1931, -1842, -1751, -1660, -1567, -1474, -1380, 
+    -1285, -1189, -1092, -995, -897, -799, -700, -601, -501, 
+    -401, -301, -201, -101
+};
+
+/* 65536 / n for each n, with 0 and 1 clamped */
+const unsigned short reciprocal_lut [] = {
+    0xffff, 0xffff, 0x8000, 0x5555, 0x4000, 0x3333, 0x2aaa, 0x2492, 0x2000, 
+    0x1c71, 0x1999, 0x1745, 0x1555, 0x13b1, 0x1249, 0x1111, 0x1000, 0x0f0f, 
+    0x0e38, 0x0d79, 0x0ccc, 0x0c30, 0x0ba2, 0x0b21, 0x0aaa, 0x0a3d, 0x09d8, 
+    0x097b, 0x0924, 0x08d3, 0x0888, 0x0842, 0x0800, 0x07c1, 0x0787, 0x0750, 
+    0x071c, 0x06eb, 0x06bc, 0x0690, 0x0666, 0x063e, 0x0618, 0x05f4, 0x05d1, 
+    0x05b0, 0x0590, 0x0572, 0x0555, 0x0539, 0x051e, 0x0505, 0x04ec, 0x04d4, 
+    0x04bd, 0x04a7, 0x0492, 0x047d, 0x0469, 0x0456, 0x0444, 0x0432, 0x0421, 
+    0x0410, 0x0400, 0x03f0, 0x03e0, 0x03d2, 0x03c3, 0x03b5, 0x03a8, 0x039b, 
+    0x038e, 0x0381, 0x0375, 0x0369, 0x035e, 0x0353, 0x0348, 0x033d, 0x0333, 
+    0x0329, 0x031f, 0x0315, 0x030c, 0x0303, 0x02fa, 0x02f1, 0x02e8, 0x02e0, 
+    0x02d8, 0x02d0, 0x02c8, 0x02c0, 0x02b9, 0x02b1, 0x02aa, 0x02a3, 0x029c, 
+    0x0295, 0x028f, 0x0288, 0x0282, 0x027c, 0x0276, 0x0270, 0x026a, 0x0264, 
+    0x025e, 0x0259, 0x0253, 0x024e, 0x0249, 0x0243, 0x023e, 0x0239, 0x0234, 
+    0x0230, 0x022b, 0x0226, 0x0222, 0x021d, 0x0219, 0x0214, 0x0210, 0x020c, 
+    0x0208, 0x0204, 0x0200, 0x01fc, 0x01f8, 0x01f4, 0x01f0, 0x01ec, 0x01e9, 
+    0x01e5, 0x01e1, 0x01de, 0x01da, 0x01d7, 0x01d4, 0x01d0, 0x01cd, 0x01ca, 
+    0x01c7, 0x01c3, 0x01c0, 0x01bd, 0x01ba, 0x01b7, 0x01b4, 0x01b2, 0x01af, 
+    0x01ac, 0x01a9, 0x01a6, 0x01a4, 0x01a1, 0x019e, 0x019c, 0x0199, 0x0197, 
+    0x0194, 0x0192, 0x018f, 0x018d, 0x018a, 0x0188, 0x0186, 0x0183, 0x0181, 
+    0x017f, 0x017d, 0x017a, 0x0178, 0x0176, 0x0174, 0x0172, 0x0170, 0x016e, 
+    0x016c, 0x016a, 0x0168, 0x0166, 0x0164, 0x0162, 0x0160, 0x015e, 0x015c, 
+    0x015a, 0x0158, 0x0157, 0x0155, 0x0153, 0x0151, 0x0150, 0x014e, 0x014c, 
+    0x014a, 0x0149, 0x0147, 0x0146, 0x0144, 0x0142, 0x0141, 0x013f, 0x013e, 
+    0x013c, 0x013b, 0x0139, 0x0138, 0x0136, 0x0135, 0x0133, 0x0132, 0x0130, 
+    0x012f, 0x012e, 0x012c, 0x012b, 0x0129, 0x0128, 0x0127, 0x0125, 0x0124, 
+    0x0123, 0x0121, 0x0120, 0x011f, 0x011e, 0x011c, 0x011b, 0x011a, 0x0119, 
+    0x0118, 0x0116, 0x0115, 0x0114, 0x0113, 0x0112, 0x0111, 0x010f, 0x010e, 
+    0x010d, 0x010c, 0x010b, 0x010a, 0x0109, 0x0108, 0x0107, 0x0106, 0x0105, 
+    0x0104, 0x0103, 0x0102, 0x0101, 0x0100, 0x00ff, 0x00fe, 0x00fd, 0x00fc, 
+    0x00fb, 0x00fa, 0x00f9, 0x00f8, 0x00f7, 0x00f6, 0x00f5, 0x00f4, 0x00f3, 
+    0x00f2, 0x00f1, 0x00f0, 0x00f0, 0x00ef, 0x00ee, 0x00ed, 0x00ec, 0x00eb, 
+    0x00ea, 0x00ea, 0x00e9, 0x00e8, 0x00e7, 0x00e6, 0x00e5, 0x00e5, 0x00e4, 
+    0x00e3, 0x00e2, 0x00e1, 0x00e1, 0x00e0, 0x00df, 0x00de, 0x00de, 0x00dd, 
+    0x00dc, 0x00db, 0x00db, 0x00da, 0x00d9, 0x00d9, 0x00d8, 0x00d7, 0x00d6, 
+    0x00d6, 0x00d5, 0x00d4, 0x00d4, 0x00d3, 0x00d2, 0x00d2, 0x00d1, 0x00d0, 
+    0x00d0, 0x00cf, 0x00ce, 0x00ce, 0x00cd, 0x00cc, 0x00cc, 0x00cb, 0x00ca, 
+    0x00ca, 0x00c9, 0x00c9, 0x00c8, 0x00c7, 0x00c7, 0x00c6, 0x00c5, 0x00c5, 
+    0x00c4, 0x00c4, 0x00c3, 0x00c3, 0x00c2, 0x00c1, 0x00c1, 0x00c0, 0x00c0, 
+    0x00bf, 0x00bf, 0x00be, 0x00bd, 0x00bd, 0x00bc, 0x00bc, 0x00bb, 0x00bb, 
+    0x00ba, 0x00ba, 0x00b9, 0x00b9, 0x00b8, 0x00b8, 0x00b7, 0x00b7, 0x00b6, 
+    0x00b6, 0x00b5, 0x00b5, 0x00b4, 0x00b4, 0x00b3, 0x00b3, 0x00b2, 0x00b2, 
+    0x00b1, 0x00b1, 0x00b0, 0x00b0, 0x00af, 0x00af, 0x00ae, 0x00ae, 0x00ad, 
+    0x00ad, 0x00ac, 0x00ac, 0x00ac, 0x00ab, 0x00ab, 0x00aa, 0x00aa, 0x00a9, 
+    0x00a9, 0x00a8, 0x00a8, 0x00a8, 0x00a7, 0x00a7, 0x00a6, 0x00a6, 0x00a5, 
+    0x00a5, 0x00a5, 0x00a4, 0x00a4, 0x00a3, 0x00a3, 0x00a3, 0x00a2, 0x00a2, 
+    0x00a1, 0x00a1, 0x00a1, 0x00a0, 0x00a0, 0x009f, 0x009f, 0x009f, 0x009e, 
+    0x009e, 0x009d, 0x009d, 0x009d, 0x009c, 0x009c, 0x009c, 0x009b, 0x009b, 
+    0x009a, 0x009a, 0x009a, 0x0099, 0x0099, 0x0099, 0x0098, 0x0098, 0x0098, 
+    0x0097, 0x0097, 0x0097, 0x0096, 0x0096, 0x0095, 0x0095, 0x0095, 0x0094, 
+    0x0094, 0x0094, 0x0093, 0x0093, 0x0093, 0x0092, 0x0092, 0x0092, 0x0091, 
+    0x0091, 0x0091, 0x0090, 0x0090, 0x0090, 0x0090, 0x008f, 0x008f, 0x008f, 
+    0x008e, 0x008e, 0x008e, 0x008d, 0x008d, 0x008d, 0x008c, 0x008c, 0x008c, 
+    0x008c, 0x008b, 0x008b, 0x008b, 0x008a, 0x008a, 0x008a, 0x0089, 0x0089, 
+    0x0089, 0x0089, 0x0088, 0x0088, 0x0088, 0x0087, 0x0087, 0x0087, 0x0087, 
+    0x0086, 0x0086, 0x0086, 0x0086, 0x0085, 0x0085, 0x0085, 0x0084, 0x0084, 
+    0x0084, 0x0084, 0x0083, 0x0083, 0x0083, 0x0083, 0x0082, 0x0082, 0x0082, 
+    0x0082, 0x0081, 0x0081, 0x0081, 0x0081, 0x0080, 0x0080, 0x0080
+};
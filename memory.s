@@ -0,0 +1,147 @@
+/* memory copy and fill routines, placed in iwram and assembled as arm code */
+.section .iwram, "ax", %progbits
+.arm
+.align 2
+
+.global memcpy32
+.type memcpy32, %function
+
+/* function to copy words: r0 = destination, r1 = source, r2 = number of words
+ * leaves r0 and r1 pointing just past the copy, which memcpy16 relies on */
+memcpy32:
+    /* save the registers used for the 8 word bursts */
+    stmfd sp!, {r4-r10}
+    /* r12 = number of 8 word blocks */
+    movs r12, r2, lsr #3
+    /* if there are no whole blocks, go to copy_rest: */
+    beq copy_rest
+copy_block:
+    /* load 8 words from the source and store them to the destination */
+    ldmia r1!, {r3-r10}
+    stmia r0!, {r3-r10}
+    /* loop until every block is copied */
+    subs r12, r12, #1
+    bne copy_block
+copy_rest:
+    /* r2 = words left over after the blocks */
+    ands r2, r2, #7
+    beq copy_done
+copy_word:
+    /* copy one word at a time */
+    ldr r3, [r1], #4
+    str r3, [r0], #4
+    subs r2, r2, #1
+    bne copy_word
+copy_done:
+    /* restore the registers and return */
+    ldmfd sp!, {r4-r10}
+    bx lr
+
+.global memset32
+.type memset32, %function
+
+/* function to fill words: r0 = destination, r1 = value, r2 = number of words
+ * leaves r0 pointing just past the fill and r1 unchanged, which memset16 relies on */
+memset32:
+    /* save the registers used for the 8 word bursts */
+    stmfd sp!, {r4-r10}
+    /* put the value in all 8 registers */
+    mov r3, r1
+    mov r4, r1
+    mov r5, r1
+    mov r6, r1
+    mov r7, r1
+    mov r8, r1
+    mov r9, r1
+    mov r10, r1
+    /* r12 = number of 8 word blocks */
+    movs r12, r2, lsr #3
+    beq fill_rest
+fill_block:
+    /* store 8 words at once */
+    stmia r0!, {r3-r10}
+    subs r12, r12, #1
+    bne fill_block
+fill_rest:
+    /* r2 = words left over after the blocks */
+    ands r2, r2, #7
+    beq fill_done
+fill_word:
+    /* store one word at a time */
+    str r1, [r0], #4
+    subs r2, r2, #1
+    bne fill_word
+fill_done:
+    /* restore the registers and return */
+    ldmfd sp!, {r4-r10}
+    bx lr
+
+.global memcpy16
+.type memcpy16, %function
+
+/* function to copy halfwords without ever writing single bytes, so it is safe for vram
+ * r0 = destination, r1 = source, r2 = number of halfwords */
+memcpy16:
+    /* if the destination and source are not aligned the same way, go to copy16_halves: */
+    eor r3, r0, r1
+    tst r3, #2
+    bne copy16_halves
+    /* if the destination is already on a word boundary, go to copy16_words: */
+    tst r0, #2
+    beq copy16_words
+    /* else copy one halfword to get both on a word boundary */
+    cmp r2, #0
+    beq copy16_done
+    ldrh r3, [r1], #2
+    strh r3, [r0], #2
+    sub r2, r2, #1
+copy16_words:
+    /* copy the pairs of halfwords as words */
+    stmfd sp!, {r2, lr}
+    mov r2, r2, lsr #1
+    bl memcpy32
+    ldmfd sp!, {r2, lr}
+    /* copy the last halfword if the count was odd */
+    tst r2, #1
+    beq copy16_done
+    ldrh r3, [r1]
+    strh r3, [r0]
+copy16_done:
+    bx lr
+copy16_halves:
+    /* copy one halfword at a time until the count runs out */
+    subs r2, r2, #1
+    blt copy16_done
+    ldrh r3, [r1], #2
+    strh r3, [r0], #2
+    b copy16_halves
+
+.global memset16
+.type memset16, %function
+
+/* function to fill halfwords without ever writing single bytes, so it is safe for vram
+ * r0 = destination, r1 = value, r2 = number of halfwords */
+memset16:
+    /* put the value in both halves of r1 */
+    mov r1, r1, lsl #16
+    orr r1, r1, r1, lsr #16
+    /* if the destination is already on a word boundary, go to fill16_words: */
+    tst r0, #2
+    beq fill16_words
+    /* else store one halfword to get on a word boundary */
+    cmp r2, #0
+    beq fill16_done
+    strh r1, [r0], #2
+    sub r2, r2, #1
+fill16_words:
+    /* fill the pairs of halfwords as words */
+    stmfd sp!, {r2, lr}
+    mov r2, r2, lsr #1
+    bl memset32
+    ldmfd sp!, {r2, lr}
+    /* store the last halfword if the count was odd */
+    tst r2, #1
+    beq fill16_done
+    strh r1, [r0]
+fill16_done:
+    bx lr
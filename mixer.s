@@ -0,0 +1,85 @@
+/* sound mixing routines, placed in iwram and assembled as arm code */
+.section .iwram, "ax", %progbits
+.arm
+.align 2
+
+.global sound_mix_channel
+.type sound_mix_channel, %function
+
+/* function to add one channel into the mix: r0 = channel, r1 = mix buffer, r2 = number of samples
+ * the channel is laid out like struct SoundChannel in gta.c: data, position, increment, length,
+ * loop length, left volume, right volume, active, with the positions in 20.12 fixed point
+ * each word of the mix has the left sum in the low half and the right sum in the high half,
+ * which can be added together in one go since the low half never overflows */
+sound_mix_channel:
+    /* save the registers, and load the channel into r4-r10 */
+    stmfd sp!, {r4-r11, lr}
+    ldmia r0, {r4-r10}
+mix_sample:
+    /* r11 = the sample at the position */
+    mov r12, r5, lsr #12
+    ldrsb r11, [r4, r12]
+    /* r12 = the left and right parts of the sample, packed into one word */
+    mul r12, r11, r9
+    mul lr, r11, r10
+    add r12, r12, lr, lsl #16
+    /* add them into the mix */
+    ldr r11, [r1]
+    add r11, r11, r12
+    str r11, [r1], #4
+    /* step the position, and if it is past the end, go to mix_end: */
+    add r5, r5, r6
+    cmp r5, r7
+    bhs mix_end
+mix_next:
+    /* loop until every sample is mixed */
+    subs r2, r2, #1
+    bne mix_sample
+    /* store the position back and return */
+    str r5, [r0, #4]
+    ldmfd sp!, {r4-r11, lr}
+    bx lr
+mix_end:
+    /* a looping sound goes back by the loop length and carries on */
+    cmp r8, #0
+    subne r5, r5, r8
+    bne mix_next
+    /* else the channel is finished, so clear active and return */
+    mov r12, #0
+    str r12, [r0, #28]
+    ldmfd sp!, {r4-r11, lr}
+    bx lr
+
+.global sound_mix_output
+.type sound_mix_output, %function
+
+/* function to turn the mix into the 8 bit samples the fifos play, clipping the ones too loud
+ * r0 = mix buffer, r1 = left samples, r2 = right samples, r3 = number of samples */
+sound_mix_output:
+    stmfd sp!, {r4-r5}
+output_sample:
+    /* r12 = the next word of the mix */
+    ldr r12, [r0], #4
+    /* r4 = the left sum in the top half, and r5 = the right sum, which is what is left
+     * of the word once the sign extended left sum is taken away */
+    mov r4, r12, lsl #16
+    sub r5, r12, r4, asr #16
+    /* scale both back down from the volume, which goes up to 32 */
+    mov r4, r4, asr #21
+    mov r5, r5, asr #21
+    /* clip them to a signed byte */
+    cmp r4, #127
+    movgt r4, #127
+    cmn r4, #128
+    mvnlt r4, #127
+    cmp r5, #127
+    movgt r5, #127
+    cmn r5, #128
+    mvnlt r5, #127
+    /* store them and loop until every sample is done */
+    strb r4, [r1], #1
+    strb r5, [r2], #1
+    subs r3, r3, #1
+    bne output_sample
+    ldmfd sp!, {r4-r5}
+    bx lr
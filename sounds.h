@@ -0,0 +1,802 @@
+/* sounds.h
+ * generated by sfxgen */
+
+#define sound_rate 18157
+
+#define sound_engine_length 256
+const signed char sound_engine [] = {
+    80, 82, 85, 87, 89, 91, 93, 95, 96, 98, 99, 100, 
+    100, 101, 101, 100, 100, 99, 98, 97, 95, 93, 91, 89, 
+    86, 83, 80, 77, 74, 71, 67, 64, 60, 56, 53, 49, 
+    46, 43, 40, 37, 34, 31, 29, 27, 25, 23, 22, 21, 
+    20, 20, 19, 19, 20, 20, 21, 22, 24, 25, 27, 29, 
+    31, 33, 35, 38, 40, 42, 45, 47, 49, 51, 53, 55, 
+    56, 58, 59, 60, 60, 61, 61, 60, 60, 59, 58, 57, 
+    55, 53, 51, 49, 46, 43, 40, 37, 34, 31, 27, 24, 
+    20, 16, 13, 9, 6, 3, 0, -3, -6, -9, -11, -13, 
+    -15, -17, -18, -19, -20, -20, -21, -21, -20, -20, -19, -18, 
+    -16, -15, -13, -11, -9, -7, -5, -2, 0, 2, 5, 7, 
+    9, 11, 13, 15, 16, 18, 19, 20, 20, 21, 21, 20, 
+    20, 19, 18, 17, 15, 13, 11, 9, 6, 3, 0, -3, 
+    -6, -9, -13, -16, -20, -24, -27, -31, -34, -37, -40, -43, 
+    -46, -49, -51, -53, -55, -57, -58, -59, -60, -60, -61, -61, 
+    -60, -60, -59, -58, -56, -55, -53, -51, -49, -47, -45, -42, 
+    -40, -38, -35, -33, -31, -29, -27, -25, -24, -22, -21, -20, 
+    -20, -19, -19, -20, -20, -21, -22, -23, -25, -27, -29, -31, 
+    -34, -37, -40, -43, -46, -49, -53, -56, -60, -64, -67, -71, 
+    -74, -77, -80, -83, -86, -89, -91, -93, -95, -97, -98, -99, 
+    -100, -100, -101, -101, -100, -100, -99, -98, -96, -95, -93, -91, 
+    -89, -87, -85, -82
+};
+
+#define sound_siren_length 64
+const signed char sound_siren [] = {
+    0, 17, 33, 48, 61, 72, 80, 85, 88, 89, 88, 86, 
+    83, 80, 77, 76, 75, 76, 77, 80, 83, 86, 88, 89, 
+    88, 85, 80, 72, 61, 48, 33, 17, 0, -17, -33, -48, 
+    -61, -72, -80, -85, -88, -89, -88, -86, -83, -80, -77, -76, 
+    -75, -76, -77, -80, -83, -86, -88, -89, -88, -85, -80, -72, 
+    -61, -48, -33, -17
+};
+
+#define sound_crash_length 9078
+const signed char sound_crash [] = {
+    58, -49, -41, 6, -58, -1, -62, -55, 29, 77, 66, -30, 
+    -76, -58, -97, -58, -33, -29, 63, -38, 59, -34, 12, -14, 
+    -68, -110, -28, 18, -52, -103, -104, -87, -49, -32, -59, 40, 
+    78, 19, 37, 52, -47, -47, 26, 80, -3, -70, 11, -29, 
+    -2, 31, 62, 36, -34, -84, 35, -56, 4, -16, -57, 29, 
+    -27, 59, -15, 67, 2, 13, -46, 21, -61, -33, -52, 4, 
+    -73, -57, -15, -27, 17, 71, 24, 38, 69, -15, -7, -14, 
+    -21, 17, 65, 93, 51, -5, 14, -66, 28, 62, -13, -27, 
+    -63, -50, 18, 71, 103, 48, 93, 50, 44, 84, 53, -26, 
+    45, 5, -61, 19, -57, 15, 37, 13, -55, -40, -33, -57, 
+    -42, 12, 14, 60, 23, -58, -62, -14, 59, 74, 66, -34, 
+    52, 72, 89, 31, 49, 93, 28, 83, -11, 60, 76, 109, 
+    -5, 2, 71, 15, 11, 39, 49, -16, -52, -5, 13, -51, 
+    -63, -95, -50, 42, 17, 57, 28, 69, 24, 79, -23, -2, 
+    -50, -26, -2, 11, 47, -38, 20, -13, 37, -3, 61, 77, 
+    -20, -68, 14, -50, 8, -64, -53, -27, 0, -15, 55, 46, 
+    34, 9, 42, -26, 11, -7, 19, -30, 22, 5, 41, 45, 
+    -20, -49, -93, -100, -117, -96, -94, -33, -72, 31, 74, -21, 
+    40, 63, 18, 41, 72, 34, 49, 71, -17, 4, -53, -12, 
+    -69, -19, 24, 24, -3, 43, 31, 82, 66, 84, 60, 36, 
+    30, -34, -49, -40, 37, 68, -30, -30, -23, 56, 7, 8, 
+    -8, 38, 82, 80, 98, 15, -45, 33, 69, -28, -26, 40, 
+    69, 45, 29, -23, 3, 0, 32, 61, 11, -56, 16, 61, 
+    82, 1, -31, -49, -53, -20, 25, 30, 23, 56, 57, 57, 
+    76, 22, -6, 39, 27, -32, 16, -12, -65, -11, -30, -67, 
+    -58, -24, -23, -49, -69, 18, 1, 49, 2, -3, 28, 61, 
+    0, -10, -36, 12, 27, -47, -77, 5, 35, 77, 36, -43, 
+    -37, -27, 32, -26, 24, -43, -29, -33, -63, -32, 17, 58, 
+    74, 61, 56, -34, -2, -49, -24, -18, -45, -10, -13, 1, 
+    -57, 18, -32, -33, -23, 46, -36, -46, 4, -18, 31, 27, 
+    65, 66, 39, 43, 13, 47, 69, -19, -39, -34, -55, -84, 
+    -95, -28, 9, -27, 46, -34, 29, 56, -25, 25, -40, -17, 
+    28, -6, 13, -21, 38, 1, 30, 54, -1, 24, -23, 29, 
+    18, 70, 74, -24, -42, 33, 20, 33, -37, -17, -24, -18, 
+    -22, 17, -34, -44, -73, -58, 16, 12, 22, -41, 22, 41, 
+    -9, 48, 50, -27, 11, 50, -32, -16, 26, 10, 32, 63, 
+    50, 6, -22, 8, 53, -12, 12, -18, -31, -2, 47, 34, 
+    7, 49, 44, 34, 54, -17, -33, -28, -54, -21, 29, 22, 
+    -40, -54, -16, -19, -6, 24, 33, 69, 13, 12, -44, -1, 
+    53, -19, 5, -55, -19, 11, 27, 15, -1, 53, 31, 69, 
+    -5, -5, 5, 56, 80, 59, -7, -1, -36, 8, 5, -24, 
+    -56, -58, 1, -11, -54, -23, -14, -12, 1, 33, 3, 34, 
+    -37, 24, -32, 14, 0, -56, -16, 28, 19, -38, -48, -65, 
+    20, 40, 62, -7, 46, 7, -13, 29, 60, 25, -35, -21, 
+    22, -16, -55, -2, -50, -7, -57, 10, 7, -32, 15, -44, 
+    13, 8, 53, 15, 40, 67, 82, 60, 34, -6, 50, 49, 
+    -18, -54, -2, 28, -19, 32, 39, 6, -20, 11, 6, -31, 
+    18, -22, 3, -6, 38, 27, -12, -52, 15, 57, 45, 68, 
+    62, 80, 10, -21, -62, -4, 9, -8, 8, 46, -7, 32, 
+    3, 48, 53, 7, -5, 31, -5, 7, -38, 28, -8, 22, 
+    59, -22, -46, -13, 46, 52, 60, 41, -4, -39, 2, 15, 
+    36, 26, 50, 13, -21, 13, 0, 24, 40, -20, -29, -10, 
+    -55, -19, -51, -13, -20, -36, -57, 24, 21, 8, -38, -40, 
+    -20, -17, -3, 16, -25, -14, 43, 21, -31, -41, 10, 53, 
+    63, 37, 67, 0, 23, 53, 26, -13, 41, 70, 34, -34, 
+    23, 28, -16, -16, 7, 47, 37, 62, 54, 21, 54, 9, 
+    -12, 37, 31, 25, 1, -25, -9, -25, -33, -32, -25, 28, 
+    21, 34, 3, 19, -36, 28, -31, -18, -57, -17, 6, -23, 
+    33, -2, -15, -40, -67, -60, -75, -7, 5, -5, -27, -2, 
+    45, -24, -45, -8, -12, -48, -40, -9, 13, -33, -65, -81, 
+    -74, -39, -30, 9, -34, -8, -3, 14, -9, 10, 44, 50, 
+    51, 4, -46, -41, 5, 49, 20, -10, -39, -61, -1, -31, 
+    -59, -7, -17, -53, -40, -23, -6, -4, -39, -16, -47, -21, 
+    -10, -48, 17, 47, 40, 55, 57, 25, -11, -46, 16, -32, 
+    4, 5, 32, 3, -16, 25, 13, -24, -56, -51, -66, 5, 
+    49, 5, -37, -34, 9, -35, 8, 7, 7, 2, 44, -8, 
+    23, 52, 47, 64, 65, -8, 27, -4, -23, -52, 14, 8, 
+    33, 45, 11, 35, -7, 9, -37, 20, 46, -18, 8, 29, 
+    58, -8, 41, 20, 16, -6, 15, 29, 16, 40, -9, 33, 
+    53, 48, 58, 5, -15, -3, -12, -8, 39, 12, 9, -11, 
+    -7, 25, 52, 51, 18, -15, -13, -52, -23, -7, -18, -42, 
+    18, -28, -35, 6, 24, 16, 39, -16, 13, 9, -29, -53, 
+    -14, 34, 44, 64, -3, -31, -57, 10, 16, 33, -5, -26, 
+    23, -8, -8, -26, -27, -23, -16, -38, 22, -15, 14, 6, 
+    -19, -53, -48, -46, -4, 36, 35, -23, -45, -46, -1, 18, 
+    20, 12, -37, 11, 4, 2, 15, 51, 43, 36, 47, 45, 
+    -3, 8, 38, 2, -41, -50, -49, -57, 9, -19, -51, -63, 
+    -60, -38, -5, -15, 1, -10, 23, 5, 30, 53, 29, -6, 
+    35, 55, 45, 47, -7, 28, 28, 30, -28, -43, -43, -41, 
+    -26, -21, 15, 43, 31, -15, 14, -14, -11, -11, -38, -41, 
+    14, -7, 8, 31, -23, 22, 27, 9, 31, -21, -53, -42, 
+    -12, -20, -50, -41, -17, -49, -54, -3, 4, -4, 4, -36, 
+    -48, -5, -43, -17, 25, 10, -23, 22, 44, -13, 15, 18, 
+    22, 40, 27, 21, 48, 53, -3, -18, -18, -4, -41, 6, 
+    19, -19, -38, -14, 13, 23, 21, 31, 3, 39, 14, 20, 
+    40, -21, 21, 17, 2, 8, 28, 19, 49, 7, -12, 29, 
+    -10, -24, 5, 0, 30, 54, 48, 20, -7, -1, 29, 0, 
+    -15, 6, -33, -36, -50, -2, 5, -13, 9, 2, -7, -6, 
+    -19, 17, -5, -16, -17, 4, 39, 32, 8, -14, -21, -8, 
+    -14, -37, -33, -24, -37, -48, 6, 26, 23, 37, 53, 48, 
+    2, -22, -47, -45, -7, -14, 14, 30, 8, 24, 49, 38, 
+    -5, -6, 7, -35, -25, 15, 11, -16, -28, -22, 11, 37, 
+    -5, 28, 37, 32, -21, -1, -8, -3, 3, -23, -17, -39, 
+    -37, -45, -52, -4, 2, -9, -19, -26, 7, -25, -19, -33, 
+    -51, 9, -33, -37, 7, -12, -24, -35, -41, 3, -20, 5, 
+    29, 16, 11, 21, 45, 35, 5, 17, 25, -4, -1, 11, 
+    13, 14, 40, 50, 20, -17, -16, -12, -30, -11, -23, -26, 
+    -14, -23, 15, 4, -34, 9, 20, 16, 4, -34, -23, -7, 
+    -20, 0, -11, 8, -3, -20, -42, -12, -13, -11, -9, -24, 
+    -9, 30, 29, 49, 34, 27, 44, -3, 1, 25, 22, 43, 
+    21, 45, 49, -7, -29, -10, -31, -29, -26, -44, -54, -5, 
+    9, 5, 28, 43, 42, 46, 18, -26, -18, -37, -28, 21, 
+    -7, -28, -8, -5, -14, -13, 9, 28, 13, -17, -22, 11, 
+    -8, 6, 24, -12, 29, 44, -8, 16, 32, 18, 43, 37, 
+    25, 34, 15, 38, 16, 42, 23, 28, 42, -8, 20, -22, 
+    -30, -15, -30, -24, 11, -3, 7, 10, -10, 8, 4, -9, 
+    -33, -40, 12, -5, -18, 10, 8, -10, 7, -13, -27, 3, 
+    32, -12, -21, -17, -15, -16, -23, -10, -2, 2, -25, 7, 
+    -6, 2, -6, -30, -23, -31, -28, -44, -24, 5, -7, -26, 
+    -25, 3, 11, 29, 40, 0, -23, -36, -34, 9, 19, -9, 
+    3, -30, -15, 2, 11, -26, -5, -18, 21, 27, -6, -32, 
+    17, 19, 0, 3, 32, 29, 35, -14, -19, 14, -3, 4, 
+    -28, -8, 28, 37, 34, 39, 46, 18, 0, 32, -10, -29, 
+    10, -1, 20, -19, -16, 15, 19, -10, -10, -5, 12, -26, 
+    -17, 19, 38, 25, 19, 18, 26, 28, -17, -16, -24, -6, 
+    10, 1, 30, -4, -1, -17, 2, 15, 11, -15, 8, -4, 
+    4, 24, 5, -15, -38, -38, -19, 1, 14, 2, -9, 2, 
+    3, 1, -31, -15, 1, 5, 6, -24, -9, -28, 15, 26, 
+    38, 34, 35, -8, -31, 1, 3, -4, -11, 8, 31, 38, 
+    -2, -17, 8, 19, 19, -11, 0, 17, 5, 30, -8, -27, 
+    2, -23, -12, -35, -14, -14, -36, -24, -20, -13, -34, -47, 
+    -11, 6, -11, -10, -3, -7, 22, 30, -6, -28, -6, -6, 
+    -27, -38, -32, 5, 13, 2, -14, 12, -12, 23, 20, -9, 
+    -28, -4, -18, -23, 3, -7, -28, -35, 4, -6, -29, -9, 
+    24, 37, 43, 41, 12, -12, -24, -40, 3, -15, -35, -17, 
+    -4, -6, -5, 15, 27, -9, 3, -14, -4, -4, 8, 10, 
+    28, 10, 2, -13, 14, -4, 26, -6, -3, -19, -8, 2, 
+    -22, -37, -16, 2, 22, 9, 0, 0, -1, -5, 19, -4, 
+    -3, 1, -27, 10, -12, -21, -14, 0, 9, 11, 21, -15, 
+    -35, 9, -16, -16, 20, -5, -12, 15, 22, -11, 9, 10, 
+    26, 32, -9, -4, 13, 27, 16, 6, -25, -31, -20, 14, 
+    3, -1, 7, 5, 24, 34, 23, -3, 11, 22, 17, 1, 
+    -13, 21, 36, 8, 12, 26, 38, -6, 11, -6, -3, -13, 
+    6, -13, -2, 5, -12, -33, -21, -38, -15, -3, -10, -1, 
+    -7, -18, -5, 0, -11, -17, -9, -8, -22, -16, 18, 21, 
+    -11, 8, -12, -21, -18, 6, -4, 1, 14, 32, -6, 19, 
+    -16, -34, -11, 15, 32, -6, 7, 27, -12, 1, -13, 3, 
+    -21, 12, 27, 28, 17, 7, 30, 28, 14, -7, 3, -6, 
+    -2, -12, -19, -36, -37, -15, -26, -8, -19, -28, -9, -19, 
+    14, 5, 14, 27, 22, -14, -21, -17, -12, -26, 8, 9, 
+    -8, -22, -6, -23, -29, 3, -9, 3, -20, 5, 16, 1, 
+    -11, -6, 17, 27, 21, 5, 26, 30, 34, -2, 1, 5, 
+    -16, -15, -27, -21, -1, -7, 2, -18, -28, -17, -15, -4, 
+    -4, 22, 1, -8, 17, -4, -5, -9, -6, -17, -17, 15, 
+    -10, 6, -8, -12, -27, -8, -16, -19, -21, -2, 0, -10, 
+    -21, -27, -34, -12, 19, -1, 21, 27, 23, -8, 10, 11, 
+    22, 17, 30, 26, -7, -18, -2, -22, -6, -25, -28, -13, 
+    15, -1, 23, -3, 20, 28, -10, 18, -2, 22, 10, -10, 
+    6, 11, 22, 16, -5, 11, 18, 20, 19, 29, 30, -3, 
+    -2, 20, 28, 12, 22, 8, -8, -25, 0, 13, 19, 13, 
+    28, 36, 2, -20, -20, -23, 5, -14, -24, -12, 4, 7, 
+    0, -6, -9, 14, -1, -24, -3, -9, 19, 26, -5, -11, 
+    3, 14, -12, 4, 21, 6, 14, 10, -11, 12, 12, -2, 
+    3, -2, -12, 4, -16, 7, -14, -4, 3, -3, 9, -5, 
+    2, 24, -6, -24, 8, 1, 1, 17, 31, -5, -14, -23, 
+    -2, 8, 26, 10, 2, 6, 24, 9, 5, -19, 7, -17, 
+    -10, -1, 9, -9, -23, -19, 7, -11, -13, 4, 13, -16, 
+    0, -16, -27, -22, -7, -15, -12, -22, -11, -23, -8, -8, 
+    1, -16, 3, -15, -12, -6, 7, 0, -21, 0, -22, -23, 
+    -21, -5, 17, 21, 5, -8, -22, 7, 5, 3, 23, 30, 
+    8, -3, -22, -16, -2, -16, -3, 7, 3, -3, 3, -15, 
+    -2, -9, 14, -14, 2, -10, 2, -5, -3, 10, 27, 4, 
+    5, 4, 17, 6, 21, 28, 5, 17, -10, -14, 8, 8, 
+    3, -9, -17, -9, 16, 4, -15, -22, -13, 13, 10, -13, 
+    -17, -26, -24, -20, -29, -28, -29, 5, 14, 7, 4, -3, 
+    -19, 6, -15, -15, 0, -19, -16, -9, -10, 12, 4, -18, 
+    7, -15, 9, 23, 3, 16, 21, 24, 15, -2, -7, 10, 
+    -2, -5, -2, 18, 23, -4, 8, 1, -3, 13, 5, 7, 
+    22, 16, -5, 9, 10, 6, 1, 3, -19, -13, -7, -18, 
+    -9, -5, 3, 0, 0, 8, 7, 7, 10, 19, -5, -2, 
+    2, -2, -17, -18, -18, -18, -7, 13, 16, 25, 31, 3, 
+    6, 9, -6, -13, -15, -12, -6, 0, -5, -8, -16, -20, 
+    5, -2, -1, -7, -8, 16, -6, 13, 20, 3, -10, 2, 
+    -19, -2, -6, -7, 12, 25, 0, -1, 6, 11, 25, 6, 
+    4, 20, 13, 22, 2, 18, 12, -3, 0, -9, 4, 14, 
+    21, 3, 8, -5, -4, 10, 11, -2, 16, 8, -12, -12, 
+    -16, 0, 2, -7, -19, -22, -1, -18, -7, -20, -19, 3, 
+    3, 6, 19, 25, 5, -3, 12, 13, 2, -7, 4, 17, 
+    2, 13, -13, 11, 1, -10, 5, 20, 17, -6, 0, -4, 
+    -8, -3, 3, 6, -8, 5, -10, -21, -10, 13, -5, -10, 
+    -21, -7, -5, 5, -3, -6, -6, 14, -2, -7, 11, -3, 
+    8, -4, -2, -3, -20, -23, 5, 3, 7, -7, 4, -8, 
+    -9, 11, 20, 6, 6, -2, 4, 9, 11, 22, -1, 2, 
+    -14, -23, 2, 7, -11, -10, 8, -15, -14, -19, -14, -24, 
+    -28, -3, -15, -13, -10, 4, -14, -21, 2, 3, -16, -9, 
+    -22, -16, -17, -17, 8, -1, 1, -17, 8, 15, -4, -10, 
+    2, 14, 8, 18, 8, -1, 0, 16, 16, -10, 7, 8, 
+    20, 11, 18, 10, 5, 6, -10, -21, -20, -15, -20, -17, 
+    -1, 12, -5, 8, -4, -19, -12, -24, 1, 10, 5, 6, 
+    5, -4, 15, 3, 13, 16, 11, -11, -2, -15, -22, -7, 
+    -15, -22, 2, 13, 7, 17, 7, 20, 21, 6, 11, 7, 
+    -1, -8, 3, -14, -8, -19, -15, 6, 17, 8, 17, 11, 
+    -6, -19, -26, -19, -1, 13, 21, 16, 15, 23, 20, 12, 
+    -3, -6, -12, -7, -16, 5, 10, -11, 0, 16, -5, 2, 
+    -3, 6, 9, 4, 13, 3, -5, 5, 8, 13, 14, -3, 
+    6, -2, -3, 10, 20, -2, -3, 13, 15, -1, 3, -13, 
+    -7, -9, 4, -15, -11, -2, 7, 20, 7, 10, -8, -19, 
+    -2, -3, -7, -17, -22, 4, -7, -6, 8, 21, 17, 6, 
+    10, 10, 5, 8, -1, -14, -4, 14, 14, 15, 5, -10, 
+    11, 9, 11, -1, -4, -18, -19, -14, 7, -9, -17, 3, 
+    -4, 0, -9, 0, -1, -8, 7, 6, 15, 6, 4, 2, 
+    -1, -8, -8, -7, 2, -13, -12, -17, -1, 0, -15, 3, 
+    -8, -2, 1, -12, 2, 15, 13, -2, -10, -3, -10, -1, 
+    14, 11, 20, 11, -2, 0, -13, -19, -14, -13, -22, -9, 
+    -14, -16, -21, -1, -16, -1, 13, 15, 13, 2, 9, -10, 
+    -3, -8, -15, -8, -1, 12, 18, -4, 1, 3, -11, -5, 
+    5, 12, 17, 1, -3, 3, 4, 8, -6, -12, -13, 1, 
+    -10, 2, -3, -6, 2, -4, -4, 9, 10, 12, 9, 13, 
+    2, 3, 9, 11, 15, 9, 1, 8, -6, -11, -10, 0, 
+    13, 14, -2, 14, 3, -12, -7, 4, 2, -13, -6, 6, 
+    17, 9, -6, -11, -6, 2, -9, -9, -12, -5, -5, -10, 
+    7, -11, 7, 1, -4, 9, -5, -17, -14, -18, 5, 8, 
+    9, 9, -1, -1, -3, -14, -9, -10, -7, 6, 3, 16, 
+    2, 3, 13, 5, -7, 4, 3, -1, -9, -5, 5, 12, 
+    -5, 1, 13, -7, 8, -4, 11, 20, 22, 25, 8, 11, 
+    -3, -7, -11, -17, 6, -5, -15, 0, -1, 12, 18, 2, 
+    15, -2, 3, 14, -5, -6, -16, -20, -14, -8, -12, -7, 
+    -18, -10, -12, -17, 5, -11, -15, -16, -15, -15, -21, -13, 
+    -10, 2, 1, -6, -8, -12, -12, -19, -10, 4, -2, -1, 
+    10, -4, 8, 4, 13, 3, 6, -11, 8, 1, 14, 2, 
+    5, 10, 2, 3, 11, 0, 10, 4, 2, -5, -7, -10, 
+    -12, 5, -8, 9, 5, 6, -3, 9, 15, 4, -5, -10, 
+    -3, -7, 5, -1, -10, -6, -11, 2, 9, -6, 1, 3, 
+    -1, 12, 16, 7, -5, 8, -5, -4, -1, -2, 0, -7, 
+    10, 7, 16, 14, 8, 2, -3, 0, -7, -11, -12, -11, 
+    5, -8, -16, -3, -7, -14, -8, 8, -4, 5, -8, -1, 
+    -6, -5, 1, 2, 3, -4, 0, -9, 1, 4, -11, 3, 
+    -9, 3, -4, 1, 7, -6, 0, 1, 2, 8, 6, -1, 
+    11, 11, 4, 0, 4, -10, 1, -8, 0, 11, 0, -5, 
+    2, 13, 3, 11, 5, 9, -7, 5, 15, 18, -1, 4, 
+    12, 19, 8, 10, 4, -11, 5, 14, 9, 13, -1, 4, 
+    -10, -8, 3, -3, -12, -10, 1, -2, -9, 5, -10, -2, 
+    -9, 6, 8, 3, 1, -4, 8, 16, 10, 11, 3, 5, 
+    14, 0, -9, -1, -11, -5, -7, -5, 3, -6, -7, -8, 
+    -5, 2, 3, 3, 1, 1, 2, 4, 7, -7, -4, -2, 
+    10, 3, 9, 9, 7, 1, -11, 7, 0, 10, 1, 6, 
+    -2, 3, -1, -2, -12, -18, -8, -8, -1, 8, 1, 1, 
+    10, 2, -7, -14, 1, -7, -15, -4, 3, 8, 12, -5, 
+    6, 12, 17, 8, -7, -2, 1, -2, -12, -11, -17, -11, 
+    -9, -11, -6, -1, -2, 8, 11, 17, 14, 16, 17, 2, 
+    -1, -5, 7, 6, -5, 3, -7, -8, -12, -14, -2, 7, 
+    1, 2, -10, 3, -7, -7, 4, -9, -16, -12, -13, -9, 
+    -1, 4, -1, 3, -2, 0, 7, -1, -6, -7, 2, -9, 
+    -2, 7, 11, 9, 1, -6, 8, 11, 9, 4, 7, 0, 
+    0, 7, 0, -11, -9, 3, 10, 12, 0, -5, 2, -4, 
+    -10, 2, -10, -5, -7, -10, -14, 0, -2, 0, 11, 1, 
+    -5, -13, -11, -16, -13, -2, 5, -7, 6, 6, -4, -10, 
+    0, -9, -4, -9, 6, 5, 0, 2, -2, -9, 0, -10, 
+    -9, 6, 5, 3, 10, 1, 4, 1, 6, 5, -2, -6, 
+    -3, 5, -3, -7, -9, 2, 12, -3, -3, 4, -3, 3, 
+    6, 5, -8, -9, -5, -13, 0, -7, -10, -5, 5, 11, 
+    4, 5, 13, 4, 5, 10, 5, -2, 5, -6, -7, -12, 
+    -9, -10, -9, -3, 6, -5, -9, -3, -6, -7, -10, -15, 
+    -3, 8, 5, -7, 1, 9, 2, 5, -1, 9, -5, -8, 
+    4, 7, 5, 8, 1, -6, 7, 11, -4, -13, -1, -4, 
+    -5, 2, 0, -10, -4, 1, 2, 4, 1, -3, 7, 14, 
+    13, -4, 5, 4, 12, 11, 15, 4, -6, -8, -13, -8, 
+    -2, -1, -3, 3, -5, 8, 12, -2, -7, -13, -16, -13, 
+    -10, -3, 1, 6, -5, 0, -8, -12, -12, 1, 7, 0, 
+    4, 2, 6, 9, 2, -1, 1, 10, 14, 6, 5, 11, 
+    8, -2, -5, -1, 6, 4, -6, -3, -2, -8, -14, -14, 
+    1, -1, -8, -1, 7, 1, 8, 7, 9, 7, 6, 10, 
+    4, -7, 1, -6, -1, 1, 6, 6, -3, 0, 3, 0, 
+    0, 5, 7, 13, 14, 1, -3, -1, -5, -12, -12, 1, 
+    2, 3, 4, -3, 2, 4, 4, 7, -3, -6, -11, -2, 
+    8, 2, 9, -2, 3, -6, -3, -3, 1, -9, -14, 1, 
+    -3, 4, -5, 0, 0, -9, -10, 5, -4, -3, 2, 8, 
+    6, -6, 2, 6, -1, 9, 0, -5, -4, -7, -10, -2, 
+    -9, 0, -2, -5, -2, 6, -5, -2, 2, 8, -4, -10, 
+    4, 9, 4, -4, -2, 7, 5, -3, -11, -10, -11, -14, 
+    -1, -7, 4, 3, -3, 1, 3, -1, -8, -4, 7, 8, 
+    4, 7, 12, 15, 13, 5, 7, 7, -5, 6, 11, 9, 
+    3, 9, -4, 6, -2, 3, -7, 2, 1, 6, 2, -1, 
+    6, -5, -5, -2, 2, -3, 5, 2, 10, -1, 5, 4, 
+    2, -1, 2, -5, -11, 1, 4, 7, 9, 4, 2, 7, 
+    4, 10, 3, -3, -7, 3, 4, 0, 1, -8, -4, -6, 
+    -2, -8, -3, -6, -7, -2, 2, 1, 3, 5, 2, -4, 
+    -7, 5, 11, 7, 2, 2, 3, 4, -1, -2, -4, 1, 
+    4, -2, 8, 1, 4, 9, -2, 6, 6, 10, 10, 9, 
+    7, 3, 5, 10, -3, -2, 4, 2, -6, 2, 5, 0, 
+    -6, -10, -14, -15, 0, 1, 8, -1, 8, -4, -8, 4, 
+    3, -3, -5, 0, 5, 6, -6, 1, 1, -3, 5, -3, 
+    0, 0, -6, 3, 8, 9, -2, -4, 4, -5, -7, 1, 
+    3, 9, 0, -6, 2, -6, 0, 7, 5, 3, -5, 1, 
+    5, 1, 7, 9, 1, 0, -1, -3, -8, 1, -4, 5, 
+    10, 3, -3, 2, -1, 0, 7, 3, 9, 10, 5, 5, 
+    11, 4, -4, -10, -12, -12, -2, -6, -3, -9, -12, -1, 
+    -6, -2, -3, 3, 1, -1, 0, -2, 2, -5, -9, -1, 
+    1, -3, 1, 7, -3, 5, 5, -5, -4, -10, -10, 1, 
+    -1, 1, -4, -2, 4, 2, -7, -4, 0, 7, 8, 5, 
+    2, -3, 2, -6, -5, -3, 5, 3, -3, -2, -9, 2, 
+    -1, 0, 6, 1, 7, 9, 3, -2, 4, 0, 2, 5, 
+    3, 6, 1, -1, 6, -2, 4, -6, 4, -1, -3, 0, 
+    -1, 4, 5, 2, -3, 5, 4, -6, -7, -8, -8, 3, 
+    -1, 6, 0, 6, 7, 10, -1, -6, -3, 5, 7, 2, 
+    -1, 2, 2, -2, 3, 2, 9, 8, -2, 1, 2, 4, 
+    1, 3, -6, -10, 2, -1, 5, -5, -2, -8, -2, -1, 
+    0, 3, 4, 9, 6, 8, 9, -1, -1, 5, -4, 1, 
+    5, 9, 1, -3, 3, 1, 3, 0, 2, 4, 7, 6, 
+    10, 4, 7, 7, 1, -1, 5, 6, 4, -3, -1, -2, 
+    1, 0, -6, -5, -4, -6, -3, -3, 3, 0, 5, 6, 
+    9, 9, -3, 4, 4, 9, 6, 6, 3, -5, -7, -5, 
+    -1, 3, 3, 1, -7, 3, 4, 4, 1, 5, -3, 3, 
+    3, -1, 5, 3, 5, 9, 1, 7, 6, -4, 1, -3, 
+    -2, -3, -8, 0, 6, 3, -4, -7, -8, -8, -4, -6, 
+    -5, -6, -7, 3, 7, 8, 5, -2, -3, 0, -3, -2, 
+    -2, 0, -7, 0, 0, 1, 6, 7, 7, -3, 1, 2, 
+    2, 0, 1, -3, 4, 5, -3, 3, 8, 7, 1, 0, 
+    5, 3, -5, -7, -10, -5, 2, -1, 1, -4, 2, 4, 
+    4, -4, 0, 2, 1, 4, -4, 4, 7, -2, 3, 8, 
+    5, -2, -8, -10, -10, -1, 6, 4, -4, 2, -5, -1, 
+    -8, -5, 0, -2, -4, 2, -3, -1, 1, 5, -4, -6, 
+    -3, 0, 5, 3, -4, -7, 1, -1, -6, -1, 4, 2, 
+    -4, 4, 0, -2, -1, 2, -2, -8, -3, 4, 7, 7, 
+    -1, -3, 3, -5, -1, -1, -5, -2, 0, 0, 2, -5, 
+    -1, 6, 5, 7, 0, -5, -7, 2, 0, 1, 1, -6, 
+    3, -3, -5, -6, -8, -5, -2, 3, -4, 2, -2, 3, 
+    -4, -5, -7, 1, 1, 1, 6, -1, 3, -4, -1, -1, 
+    6, 1, 1, -5, -4, -6, -2, 3, -2, -6, -2, -7, 
+    2, 0, 2, 3, 8, 0, -5, 0, -3, 3, -5, -2, 
+    -3, -2, -2, 2, 6, 7, 4, 3, -4, -1, 1, 3, 
+    -3, -3, -1, -6, -7, -2, 3, -5, -3, -3, -2, -1, 
+    2, 0, 4, 1, 1, 2, 7, 4, 5, 1, 3, 0, 
+    -3, 3, 4, 0, -3, 0, -6, -4, -5, -4, 0, 4, 
+    4, 3, 3, 7, 9, 8, 10, 7, 9, 5, -1, 1, 
+    -2, -6, -9, -6, -2, -3, -4, 1, -1, 0, -5, 3, 
+    3, 1, -3, 5, 8, 9, 10, 4, 3, 6, 5, 3, 
+    4, -3, -4, -4, 1, -1, 2, -4, 1, 3, -1, -6, 
+    0, -5, 1, 4, 2, -1, 3, 3, 5, -2, 4, -2, 
+    1, -3, -2, -7, -1, 1, 0, 1, -3, 1, 1, 2, 
+    5, -3, -7, -4, -3, 3, 6, 7, -2, 3, 6, 9, 
+    9, 7, -2, 1, 3, 1, 4, 4, 4, 6, 2, 5, 
+    7, 7, 3, 4, 4, -1, 3, 6, -2, -2, 1, 0, 
+    1, -3, 2, -4, -4, -4, -6, -7, -8, -8, 0, -4, 
+    -4, -1, -4, -6, -5, -4, 0, -4, -7, -7, -3, 0, 
+    0, -5, -7, -6, -5, -3, -4, 3, 2, 6, 1, 3, 
+    1, 3, -3, -7, -6, -7, -6, -3, -5, -4, 2, 0, 
+    5, -2, 0, -4, 2, -4, -8, -8, -8, -3, 0, 5, 
+    2, -2, -1, -2, 2, 4, 0, -2, -4, 3, -1, -2, 
+    2, -3, -2, 1, 0, 3, 0, -4, 3, 3, -3, 4, 
+    0, -5, -1, 4, 5, 1, 0, -2, -4, -1, 2, 4, 
+    1, -4, -7, 0, 1, 4, 2, 3, -3, 0, -1, -4, 
+    0, 4, 1, -5, -1, -2, -3, 4, -1, -2, -6, -2, 
+    2, 5, 4, 1, 1, 2, 4, 3, 6, 1, 2, 1, 
+    -1, -1, -4, 3, 1, -4, -4, 3, -4, -1, -2, 2, 
+    -1, 2, 0, -2, -1, 3, 3, -3, -1, 0, -2, -1, 
+    -3, -5, -6, 0, 1, -4, 3, 4, -1, 3, 6, 6, 
+    0, 4, -1, -1, -5, 1, 5, 0, -1, -2, -3, -5, 
+    1, 1, -3, 3, 0, 4, 2, 5, -1, -2, -2, 3, 
+    5, 4, 0, 1, -3, 2, 0, 4, 4, 3, -1, 2, 
+    4, 3, 4, 7, 0, 0, -1, 2, -3, -3, -4, 2, 
+    2, 0, -1, 1, -3, 3, -2, 1, -4, -2, 1, -1, 
+    -5, -3, -5, 2, -1, 1, 1, -4, 3, 5, 2, 4, 
+    -3, 2, 0, -1, -3, -3, -3, 1, 2, 0, -4, -6, 
+    -8, -7, -8, 0, -1, -2, -3, -5, -1, 2, 4, 5, 
+    1, 1, -4, 0, 0, 1, 0, -1, -3, 0, 2, -2, 
+    -5, -4, -5, -5, 1, 0, 0, 0, 1, 3, 3, -1, 
+    -2, -2, -5, -5, 1, 1, 5, -2, -4, 0, -5, 1, 
+    -2, 1, 1, 0, -2, -1, -2, -1, -2, -1, -3, 3, 
+    1, -3, 2, 5, 6, 5, 3, 1, -2, -4, -5, 1, 
+    1, 4, -1, -1, -4, -1, -1, 1, 4, 1, -3, 0, 
+    -1, 3, 0, -2, -5, -2, -4, 0, 3, 3, 1, 2, 
+    1, -3, -3, -4, -3, -4, 0, -1, -1, 2, 5, 5, 
+    3, 4, 1, 0, 0, -2, 3, 5, 6, 1, 2, -2, 
+    2, 3, 2, -1, -2, 1, 5, -2, -1, 3, 2, 0, 
+    -4, 2, 4, 4, 2, -2, -5, -2, 3, 2, -2, -2, 
+    1, 2, 2, 3, -1, -5, 0, 4, 5, 5, -2, -4, 
+    -2, 1, 3, -2, -1, -5, 2, 0, 2, 4, 3, 0, 
+    -1, 4, -2, 1, -1, 0, 1, 2, 2, -1, 0, 4, 
+    3, 3, 1, -3, -1, 2, -2, -3, -3, -5, 1, -2, 
+    0, -1, 3, -1, 2, 0, -4, -3, -4, -5, -3, -6, 
+    -5, -5, 1, 1, 3, -1, -1, -2, -1, 1, 4, 4, 
+    -1, 1, 0, -2, -2, -2, -2, -1, -1, -4, -4, -3, 
+    -2, -5, -4, 2, 2, 3, 4, 6, 7, 7, 1, -2, 
+    -3, -3, -5, -4, -5, -1, -3, -4, -5, -2, 0, 3, 
+    5, 6, 3, -2, 3, 5, 2, 3, -2, -3, -2, -2, 
+    0, 2, 4, 1, 4, 0, 0, 3, 4, 4, 3, -2, 
+    -5, 0, 0, 0, 1, -2, -3, 1, 0, -2, -4, -3, 
+    2, -2, 3, -2, 3, 2, 1, 4, 5, -1, -3, -5, 
+    -3, -1, 3, 5, 1, -2, -4, 1, -1, 2, 3, -2, 
+    -2, -1, 3, 4, -2, 3, 1, 1, -1, -2, 0, -4, 
+    -2, -2, 1, 3, 0, 1, -1, 0, 3, 0, 1, -1, 
+    0, -4, 1, 2, 1, -3, -4, 2, -1, 1, -2, -1, 
+    -2, -2, -1, 2, 4, 4, 5, 0, -3, -4, -4, -5, 
+    0, -1, 2, 3, 1, -2, 0, 0, -1, 2, 1, -1, 
+    2, 5, 5, 2, -2, 0, 1, 3, 0, 3, 2, 0, 
+    0, -2, -2, -1, -4, -3, 1, -2, -4, -2, -2, -3, 
+    -1, -1, -3, -2, 0, 2, 3, -1, 2, -2, 1, 3, 
+    3, 0, 3, -1, 1, -1, -1, -1, 2, 4, 4, 2, 
+    3, 2, 4, -1, -3, 0, 0, 2, 2, 2, -2, 0, 
+    -2, 1, -2, -3, -1, 2, -1, -2, 2, 2, 1, 1, 
+    1, 2, 0, -2, -4, -2, -1, 3, 1, -3, -2, -2, 
+    1, -2, 1, -2, -4, -5, -1, -4, 1, 3, -1, -4, 
+    -1, 1, -2, 2, 2, 2, -1, 0, -1, 1, 1, 4, 
+    4, 0, -2, 0, 1, 0, 0, 2, 3, 3, 4, 5, 
+    6, 3, 5, 0, 1, 3, 2, 1, -2, -3, -1, -3, 
+    0, -2, -2, 2, 1, 3, -2, 1, 4, 5, 3, 0, 
+    -1, -3, -3, 2, -2, -2, -2, -4, 0, -1, -4, 1, 
+    -2, 2, 3, -1, 0, 2, 3, -1, 1, 0, 2, 0, 
+    -1, -1, 2, -2, -2, -1, -3, -2, -2, 0, 1, 3, 
+    1, -2, 1, -3, 2, 3, -2, 1, 0, 2, 2, 3, 
+    0, 3, 3, 4, -1, -2, 2, 2, 4, 0, -3, 2, 
+    3, -1, 0, -3, -1, -1, 3, 4, 3, 4, 5, 3, 
+    4, 2, 4, 4, -1, 1, 0, -1, -1, 3, 3, 3, 
+    -1, -1, 0, -1, 2, 0, 2, 2, 0, 0, -1, 0, 
+    2, 4, 0, -2, 0, 1, -2, 0, 0, -3, -4, -4, 
+    -4, -2, 2, -2, 1, 1, 1, -2, 1, -1, -4, -3, 
+    -1, 0, -2, -1, -1, 1, -2, -4, 1, 1, 1, 2, 
+    0, -1, -3, 0, 1, 2, -1, -1, -1, -3, 1, -2, 
+    -3, -4, -2, -4, -5, -2, -4, -3, -4, -4, -4, -2, 
+    -2, 1, 0, -3, -1, -3, 1, -1, -1, -3, -2, 0, 
+    -1, -3, 0, -1, 1, 1, 1, 3, 0, 3, 2, 2, 
+    3, -1, -2, 2, -1, 0, -2, 2, 2, 3, 4, 0, 
+    3, 2, 1, 1, 3, 2, 2, -1, -3, -1, 0, -1, 
+    -3, 0, 1, 0, -1, 1, 3, 1, 2, -1, -2, 1, 
+    2, 1, 3, 0, -2, -1, -3, -2, -1, 1, 0, 3, 
+    1, -1, -1, 2, -1, 0, 3, 3, -2, 0, 3, -1, 
+    1, 2, 2, 1, 1, 1, 1, 3, 1, -2, 1, -1, 
+    -3, 1, 2, -1, 0, 2, 2, 3, -1, 0, -1, 0, 
+    -3, 0, 2, 2, 1, -1, 2, 3, 3, 3, 4, 4, 
+    2, 1, 2, 3, 1, -2, 0, 0, 2, -2, -2, -2, 
+    -1, 0, 0, -2, -1, 1, -2, 1, 3, 1, -1, -2, 
+    -1, 0, 3, 0, 3, 3, 2, 3, 0, 0, 0, -1, 
+    -2, 0, 2, -1, -1, 2, 0, 0, 0, 0, 2, -1, 
+    0, 1, 3, 3, -1, -3, -1, 2, 2, 2, 3, 0, 
+    -1, 1, 3, 4, 1, 3, 0, -2, 1, 2, 0, -1, 
+    0, -1, 1, 1, -2, 0, 2, 0, -2, -1, 1, 1, 
+    3, 0, 1, 1, -1, -2, -2, -1, -1, 2, -2, 2, 
+    -1, -1, 2, 3, -1, -1, -3, -3, -1, -1, 0, -1, 
+    -1, 1, 2, 2, -1, 2, 0, -1, 2, 0, 1, 2, 
+    1, 0, 2, 1, 0, 2, 3, 1, -2, -2, 0, -1, 
+    2, 0, -1, -2, 0, -2, 1, -1, -3, -2, -1, 0, 
+    -1, -3, 0, 1, 0, 2, 1, 2, 1, -1, 2, -1, 
+    2, 2, 2, 1, -1, -2, -1, -2, 1, 2, -1, -1, 
+    -2, -2, -3, 1, -1, 2, -1, 2, 2, 2, 3, 1, 
+    0, -1, 1, 0, -2, 0, -2, -3, -3, -2, -1, -2, 
+    -2, -2, 0, -1, -1, -1, 0, -2, 0, 2, 3, 2, 
+    0, 1, 3, 1, 1, 0, -1, 1, 2, 3, -1, -2, 
+    -1, -1, -1, -3, -2, -3, -1, 1, -1, 0, -2, -3, 
+    -1, 0, 1, 1, -2, -3, 0, 0, 0, 0, 2, 2, 
+    2, 0, 1, -1, -1, 0, 1, -2, 2, 2, 2, 3, 
+    -1, -1, 0, 2, 2, -1, -3, -2, 1, 3, 3, 2, 
+    0, 1, 0, 0, 0, 0, 2, 1, -1, 2, 1, 2, 
+    3, 1, 2, 1, 2, 1, -1, -1, -1, 0, -2, -3, 
+    0, 0, -1, -2, 0, 1, 2, -1, 2, 2, 0, 0, 
+    -1, -2, -1, 1, 3, 0, 0, 1, 1, 3, 0, 1, 
+    0, 1, 0, 1, 2, 1, 2, 0, -1, 1, 1, 2, 
+    0, 0, 2, 1, -1, -1, 1, -1, -2, -3, -2, 1, 
+    -1, 1, -2, -1, 1, 2, 0, 2, -1, -2, 0, -1, 
+    1, -1, -2, -3, 0, -1, -2, -1, 1, 2, -1, 1, 
+    1, -1, -2, 1, 2, 2, 3, 3, 1, 3, 3, 3, 
+    2, 0, -2, -2, -2, 1, 2, 0, 0, 0, 2, -1, 
+    0, 1, 2, 0, -2, 1, 0, 1, 0, -1, -1, 0, 
+    0, 1, 2, -1, 1, 1, 0, 1, 1, 3, 2, 3, 
+    0, -1, -2, 0, -1, 0, 0, -1, -2, 1, -1, -1, 
+    -2, -1, -2, 0, 1, 2, 1, -1, -1, -2, 0, 1, 
+    2, 1, 1, 0, -1, -2, -3, -3, -2, 0, 0, -1, 
+    0, -2, 0, -2, -1, -2, 0, 0, -1, 1, 0, 1, 
+    -1, -1, 1, -1, 1, 2, 0, 2, 1, -2, 0, 1, 
+    1, 1, 0, -1, 1, 0, 0, 1, 1, 0, 2, 1, 
+    0, -1, -2, -3, -3, -1, 1, 0, -1, -1, 1, 0, 
+    -1, 1, 1, -1, 0, 1, 1, 1, 0, 0, 1, 0, 
+    0, -1, 0, 0, 2, -1, 2, -1, 0, -1, 1, 2, 
+    2, 0, -2, -1, 1, 1, 0, -1, -2, -2, -3, -3, 
+    -2, 0, 0, 1, 0, 1, 0, 0, 2, 1, 1, 1, 
+    1, 0, -1, 0, -2, 1, 1, 2, 1, -1, 1, 1, 
+    1, 2, 3, -1, 0, 2, 2, 1, 3, 0, 0, 1, 
+    0, -1, -2, -1, -2, 0, 1, 1, 0, -2, -1, 0, 
+    1, 0, -1, 0, 1, 1, 1, 1, 2, 0, -1, 1, 
+    -1, 0, 0, 0, 1, 2, 1, 1, 1, 1, 0, 1, 
+    -1, -2, 1, 0, -2, -1, 1, 0, -1, 0, 1, 2, 
+    -1, -1, -1, -2, 0, 2, 1, 2, -1, 1, 0, -1, 
+    -1, 0, 1, 1, 0, 1, 1, 0, -1, 0, 1, 1, 
+    0, -2, 0, 1, 1, 1, 0, -1, 0, 1, 2, -1, 
+    1, 1, 2, 2, 1, 2, 2, 2, 2, 2, 2, 1, 
+    -1, 0, 1, 2, 2, 0, 0, 1, 1, -1, 1, 0, 
+    1, -1, -1, 0, 0, 0, -1, 0, 0, -1, 0, 2, 
+    0, -1, 0, 0, 0, 2, 2, 0, -1, 0, 0, 1, 
+    1, 2, 2, -1, 1, 1, 1, -1, -2, -1, -2, 0, 
+    0, 1, -1, -1, 0, -1, -1, -1, -2, -1, -2, 0, 
+    1, 0, 0, 1, 1, 2, 2, -1, 0, -1, 1, 1, 
+    2, 1, -1, -1, 1, 0, 0, -2, 0, 2, 0, -2, 
+    -1, 0, 1, 1, 2, 0, -1, -1, -1, 1, 1, 0, 
+    -1, -2, -2, -2, -3, 0, 0, 1, 1, 0, -1, -1, 
+    1, 2, 0, 0, 1, 1, 1, -1, -1, -1, -1, 0, 
+    1, 1, 2, 0, 1, 0, 2, 2, 0, -1, -2, -1, 
+    -2, -1, 0, 0, 1, 2, 2, 1, 2, -1, 0, 0, 
+    0, 1, 0, 1, 0, -1, 0, 1, 2, 1, 1, 1, 
+    0, 2, 1, 2, 1, 2, 0, 1, 2, 2, 0, -1, 
+    -1, 0, 0, 0, 1, 1, 0, 0, 0, -1, 0, 0, 
+    -1, 0, -1, -1, 1, 2, 0, 0, 1, 0, 1, 0, 
+    2, 2, 0, 1, -1, -2, -2, -2, -2, -1, -1, 1, 
+    -1, 0, 2, 1, 0, 0, 0, -1, -2, 0, -1, -1, 
+    -2, -1, 0, 1, 1, -1, -1, 1, 1, 0, 0, -1, 
+    -1, -1, -1, 0, 1, 0, -1, 1, 0, -1, -1, -1, 
+    -2, -2, -2, -2, -2, -2, -2, -2, -1, 0, 0, 1, 
+    0, 0, -1, -1, -2, -1, -2, -1, 0, 0, 0, 0, 
+    0, 1, -1, 0, 1, -1, 0, 1, 0, 1, 1, 0, 
+    -1, -2, 0, -1, 1, -1, 0, 1, 1, 2, 0, 0, 
+    0, 0, -1, 0, -1, -2, -2, -2, 0, 1, 0, 0, 
+    0, 0, 1, 2, 0, 1, -1, 0, -1, 1, 2, 2, 
+    1, 0, 0, 1, 1, 0, 1, 1, 0, -1, 0, 0, 
+    -1, -1, 1, 0, 0, 0, 1, 1, -1, -1, -1, -2, 
+    0, 1, 1, 0, 0, 0, 0, 0, -1, -1, -1, -1, 
+    0, 0, 0, 0, 1, -1, -1, 1, 1, 1, 0, -1, 
+    -1, 0, 1, 0, 1, 0, 1, 2, 0, 1, -1, 0, 
+    1, 0, -1, -1, -2, -2, -1, -1, -2, -1, 0, 0, 
+    -1, -1, -2, 0, 0, 1, 1, 2, 1, 0, 0, 0, 
+    -1, 0, 1, 0, 1, 1, 1, -1, -1, -1, -2, -1, 
+    -2, 0, -1, 1, 1, -1, 0, 1, -1, 0, 0, 1, 
+    1, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, -1, 
+    1, 1, 1, 0, 1, 1, 0, -1, 0, 1, 1, 1, 
+    0, 1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 
+    1, 0, 0, 1, 1, 0, 0, 1, 0, 1, -1, 1, 
+    0, 1, 0, 0, 1, -1, 0, 1, 1, -1, -1, -1, 
+    -1, -1, 0, 0, 0, -1, -2, 0, 0, 0, -1, -1, 
+    -1, -1, 0, -1, -1, 0, 1, 1, -1, 0, 0, -1, 
+    -1, 0, 1, -1, -1, 1, 0, -1, -1, 0, 0, 1, 
+    1, 0, 1, 1, 0, -1, 0, 0, -1, 0, 0, -1, 
+    -1, 0, -1, 1, 2, 2, 2, 2, 0, -1, 0, -1, 
+    0, 0, -1, -1, -1, 0, 1, 1, 0, 0, 0, 1, 
+    1, 0, 0, -1, -1, -1, -2, -2, 0, 0, 0, -1, 
+    1, 1, 0, -1, -1, 0, 1, 0, -1, 0, 0, 0, 
+    1, -1, -1, 1, 1, 1, 2, 0, 0, -1, -1, -2, 
+    0, 1, 0, -1, -1, 0, -1, 0, 1, 1, 0, 1, 
+    0, 0, -1, -1, -1, 0, 0, -1, -1, -1, -2, -1, 
+    -1, 0, 1, 0, 0, 1, 0, -1, -1, -1, 0, 0, 
+    0, -1, 1, 1, 1, 0, 1, 1, 0, -1, 0, 0, 
+    -1, -1, 0, 0, 0, 1, 0, -1, 1, 1, 2, 2, 
+    0, 1, 0, 0, -1, -1, -1, -1, 0, -1, -1, 0, 
+    1, 1, 1, 0, 1, 2, 1, 0, -1, -1, 0, 1, 
+    1, -1, 0, 1, 1, 1, 0, 0, -1, 1, -1, 0, 
+    0, 1, 1, 1, 0, -1, -1, -1, 0, -1, -1, 0, 
+    1, 1, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 
+    0, 0, -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 
+    -1, 0, 1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 
+    0, 0, 0, -1, -2, 0, 1, 1, 1, 0, 0, 0, 
+    0, 1, 1, 1, 0, -1, -1, -1, 0, 1, 1, 0, 
+    0, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 
+    1, -1, 0, 1, 0, 1, 1, 0, 1, 0, -1, -1, 
+    -1, 0, 1, 0, 1, 0, -1, -1, 0, 1, 1, 1, 
+    1, 1, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 
+    1, 1, 1, -1, 0, -1, -1, -1, -1, -1, 0, 0, 
+    -1, -1, 0, -1, 0, 0, 1, 1, 0, -1, 0, 1, 
+    -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, 0, 1, 
+    1, 2, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 
+    0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 
+    0, 1, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 
+    -1, -1, -1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 
+    -1, -1, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, 
+    -1, -1, 0, -1, 0, 1, 0, -1, -1, -1, -1, 0, 
+    0, 1, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1, 
+    -1, 0, -1, 0, 1, 1, 0, 0, 0, -1, 0, 0, 
+    0, 1, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 
+    0, 0, 0, 0, 1, 1, 0, 1, 0, -1, -1, -2, 
+    0, 1, 0, -1, 0, -1, -1, -1, 0, 1, 1, -1, 
+    -1, -1, 0, 1, 0, 0, 1, 1, 1, 0, 0, 0, 
+    0, 1, 1, 0, -1, 0, -1, 0, -1, 0, -1, 0, 
+    1, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, -1, 0, -1, -1, 0, 0, 0, 0, 0, 
+    -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 
+    0, 1, 1, 1, 1, 0, 0, 0, -1, 0, 0, 0, 
+    -1, 0, -1, 1, 0, 0, 0, 0, 1, 0, 1, 0, 
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 
+    -1, 0, 0, 0, 0, 0, -1, 0, 1, 0, 0, 1, 
+    1, 1, 1, 0, 0, 0, 0, 1, 0, -1, 0, 1, 
+    0, -1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 
+    1, 1, 0, 0, 0, 0, -1, -1, 0, 1, 1, 0, 
+    -1, -1, -1, 0, 1, 0, -1, 0, 0, 0, 0, 0, 
+    -1, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 
+    0, 0, 1, 0, 1, 0, -1, 0, 0, 1, 0, 0, 
+    -1, -1, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, 
+    0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 
+    -1, 0, -1, -1, -1, -1, -1, 0, 1, 0, 1, 1, 
+    1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 
+    -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 
+    0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 
+    0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 
+    0, 0, -1, -1, 0, 1, 0, 0, -1, 0, 1, 0, 
+    0, -1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 
+    0, 0, 0, 1, 0, 0, -1, 0, 0, 1, 1, 1, 
+    0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 
+    0, -1, 0, 0, 0, 0, 0, -1, 0, -1, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 
+    -1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, -1, 
+    -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 1, 
+    0, 0, 1, 1, 0, -1, -1, -1, -1, -1, -1, 0, 
+    0, 0, 1, 0, 1, 0, -1, 0, -1, -1, 0, 1, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 
+    0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 
+    0, 1, 0, -1, -1, -1, 0, -1, 0, 0, 0, 0, 
+    -1, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 
+    0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, 
+    0, 1, 0, 0, 0, 1, 1, 1, 1, 1, 0, -1, 
+    -1, -1, 0, 0, -1, 0, 0, 0, 0, 1, 1, 1, 
+    1, 1, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 
+    -1, 0, 0, 0, 0, -1, 0, -1, -1, 0, -1, 0, 
+    -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 
+    -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    1, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, -1, 
+    -1, 0, 0, 1, 0, 1, 0, 1, 0, 0, -1, 0, 
+    -1, 0, 0, -1, 0, -1, -1, -1, 0, 0, 1, 1, 
+    0, 1, 0, 0, 0, 0, 0, -1, 0, 0, -1, 0, 
+    0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 0, 0, 
+    0, -1, -1, 0, 1, 1, 0, 0, 0, 1, 0, -1, 
+    -1, -1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 1, 0, 
+    0, 1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, 0, 
+    0, 1, 0, 0, 0, -1, -1, 0, 0, 1, 0, 0, 
+    1, 0, 0, -1, 0, 0, 0, 1, 0, 0, 0, 1, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 
+    -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, 0, 
+    0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 
+    -1, -1, -1, -1, 0, -1, -1, -1, 0, 0, 0, -1, 
+    -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 1, 1, 1, 0, 1, 0, 0, 
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 
+    0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 1, 0, 0, 0, -1, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 1, 1, 0, 0, 0, -1, 0, 0, 
+    0, 0, 0, -1, 0, 0, -1, 0, 1, 0, 1, 1, 
+    0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 
+    0, 0, 1, 0, 1, 0, 0, 0, 0, 0, -1, 0, 
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 
+    0, -1, -1, 0, -1, 0, 0, 0, -1, 0, -1, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, -1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+    0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 
+    -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 
+    0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, 
+    0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    -1, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, -1, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 
+    0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 
+    -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+    0, 0, 0, 0, 0, 0
+};
+
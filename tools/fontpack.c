@@ -0,0 +1,79 @@
+/* fontpack.c
+ * packs the 8x8 font in text.h down to 1 bit per pixel, or 2 for fonts with an outline,
+ * using the palette indices palpack gave it, and prints the result as font.h
+ *
+ * build and run on the host, after palpack:
+ *     gcc -o fontpack tools/fontpack.c && ./fontpack > font.h */
+
+#include <stdio.h>
+
+#include "../text.h"
+#include "../assets.h"
+
+/* the first glyph in the image is the space character, and the rest follow in ascii order */
+#define FIRST_CHAR 32
+#define GLYPH_BYTES 64
+#define NUM_GLYPHS (text_width * text_height / GLYPH_BYTES)
+
+int main() {
+    unsigned char colors[4] = {0, 0, 0, 0};
+    int color_count = 1;
+    static unsigned char codes[text_width * text_height];
+
+    /* give each color the font uses a code, with transparent as code 0 */
+    for (int i = 0; i < text_width * text_height; i++) {
+        unsigned char color = text_remap[text_data[i]];
+        int code;
+        for (code = 0; code < color_count && colors[code] != color; code++) { }
+        if (code == color_count) {
+            if (color_count == 4) {
+                fprintf(stderr, "fontpack: the font uses more than 4 colors\n");
+                return 1;
+            }
+            colors[color_count++] = color;
+        }
+        codes[i] = code;
+    }
+
+    int bits = color_count <= 2 ? 1 : 2;
+    int per_byte = 8 / bits;
+    int bytes = text_width * text_height / per_byte;
+
+    printf("/* font.h\n");
+    printf(" * generated by fontpack from text.h\n");
+    printf(" * %d bytes, the font at 8 bits per pixel is %d bytes */\n\n", bytes, text_width * text_height);
+    printf("#define font_glyphs %d\n", NUM_GLYPHS);
+    printf("#define font_first_char %d\n", FIRST_CHAR);
+    printf("#define font_bits %d\n\n", bits);
+
+    printf("/* the palette index drawn for each code */\n");
+    printf("const unsigned char font_colors [] = {\n    ");
+    for (int i = 0; i < (1 << bits); i++) {
+        printf("0x%02x%s", colors[i], i == (1 << bits) - 1 ? "\n" : ", ");
+    }
+    printf("};\n\n");
+
+    /* glyphs stay in tile order, with the first pixel in the lowest bits of each byte */
+    printf("/* the glyphs in tile order, %d pixels to a byte with the leftmost in the lowest bits */\n", per_byte);
+    printf("const unsigned char font_data [] = {\n");
+    for (int i = 0; i < bytes; i++) {
+        int value = 0;
+        for (int j = 0; j < per_byte; j++) {
+            value |= codes[i * per_byte + j] << (j * bits);
+        }
+        if (i % 12 == 0) {
+            printf("    ");
+        }
+        printf("0x%02x", value);
+        if (i != bytes - 1) {
+            printf(", ");
+        }
+        if (i % 12 == 11 || i == bytes - 1) {
+            printf("\n");
+        }
+    }
+    printf("};\n");
+
+    fprintf(stderr, "fontpack: %d glyphs at %d bits per pixel, %d bytes\n", NUM_GLYPHS, bits, bytes);
+    return 0;
+}
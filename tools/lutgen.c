@@ -0,0 +1,59 @@
+/* lutgen.c
+ * prints the sine and reciprocal lookup tables as luts.h
+ *
+ * build and run on the host:
+ *     gcc -o lutgen tools/lutgen.c -lm && ./lutgen > luts.h */
+
+#include <math.h>
+#include <stdio.h>
+
+/* a full turn is 256 angle steps, sines are in 4.12 fixed point */
+#define ANGLES 256
+#define SIN_SHIFT 12
+
+/* reciprocals of 0 to 511 in 16.16 fixed point, clamped to fit a halfword, enough for the
+ * scanlines below the horizon of the perspective view */
+#define RECIPROCALS 512
+
+int main() {
+    printf("/* luts.h\n");
+    printf(" * generated by lutgen */\n\n");
+    printf("#define lut_angles %d\n", ANGLES);
+    printf("#define lut_sin_shift %d\n", SIN_SHIFT);
+    printf("#define lut_reciprocals %d\n\n", RECIPROCALS);
+
+    printf("/* sine of each angle, the cosine is the sine a quarter turn on */\n");
+    printf("const short sin_lut [] = {\n");
+    for (int i = 0; i < ANGLES; i++) {
+        int value = (int) lround(sin(i * 2.0 * M_PI / ANGLES) * (1 << SIN_SHIFT));
+        if (i % 9 == 0) {
+            printf("    ");
+        }
+        printf("%d", value);
+        if (i != ANGLES - 1) {
+            printf(", ");
+        }
+        if (i % 9 == 8 || i == ANGLES - 1) {
+            printf("\n");
+        }
+    }
+    printf("};\n\n");
+
+    printf("/* 65536 / n for each n, with 0 and 1 clamped */\n");
+    printf("const unsigned short reciprocal_lut [] = {\n");
+    for (int i = 0; i < RECIPROCALS; i++) {
+        int value = i < 2 ? 0xffff : 65536 / i;
+        if (i % 9 == 0) {
+            printf("    ");
+        }
+        printf("0x%04x", value);
+        if (i != RECIPROCALS - 1) {
+            printf(", ");
+        }
+        if (i % 9 == 8 || i == RECIPROCALS - 1) {
+            printf("\n");
+        }
+    }
+    printf("};\n");
+    return 0;
+}
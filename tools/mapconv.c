@@ -0,0 +1,199 @@
+/* mapconv.c
+ * converts the flat tile map in gta_map.h into 16x16 pixel metatiles (2x2 tiles each),
+ * chunks of 8x8 metatiles, and a world made of chunks, printing the result as gta_world.h
+ * along with a collision map of 2 bits per world tile
+ *
+ * build and run on the host:
+ *     gcc -o mapconv tools/mapconv.c && ./mapconv > gta_world.h */
+
+#include <stdio.h>
+
+#include "../gta_map.h"
+
+#define CHUNK_SIZE 8
+#define MAX_METATILES 256
+#define MAX_CHUNKS 64
+
+/* the map is cut into chunks, and the world lays them out again:
+ * the city and the waterfront below it, repeated four times across and twice down */
+#define WORLD_CHUNKS_WIDTH 8
+#define WORLD_CHUNKS_HEIGHT 4
+#define MAP_CHUNKS_WIDTH (gta_map_width / 2 / CHUNK_SIZE)
+
+const unsigned char world_layout[WORLD_CHUNKS_HEIGHT][WORLD_CHUNKS_WIDTH] = {
+    {0, 1, 0, 1, 0, 1, 0, 1},
+    {2, 3, 2, 3, 2, 3, 2, 3},
+    {0, 1, 0, 1, 0, 1, 0, 1},
+    {2, 3, 2, 3, 2, 3, 2, 3}
+};
+
+/* collision classes, which must match the TILE_ values in gta.c */
+#define ROAD 0
+#define SIDEWALK 1
+#define SOLID 2
+#define WATER 3
+
+/* the collision class of each tile in background.h, anything past the table is solid */
+#define CLASSIFIED_TILES 22
+const unsigned char tile_classes[CLASSIFIED_TILES] = {
+    WATER, ROAD, ROAD, ROAD, ROAD, ROAD, ROAD, SIDEWALK, SIDEWALK, SOLID, WATER,
+    WATER, ROAD, ROAD, ROAD, ROAD, ROAD, ROAD, SIDEWALK, SIDEWALK, SOLID, SOLID
+};
+
+/* the collision map packs 16 tiles into each word, lowest bits first */
+#define TILES_PER_WORD 16
+
+unsigned short metatiles[MAX_METATILES][4];
+int metatile_count = 0;
+
+unsigned char chunks[MAX_CHUNKS][CHUNK_SIZE * CHUNK_SIZE];
+int chunk_count = 0;
+
+/* function to find a metatile, adding it if it is new */
+int find_metatile(const unsigned short* tiles) {
+    for (int i = 0; i < metatile_count; i++) {
+        if (metatiles[i][0] == tiles[0] && metatiles[i][1] == tiles[1] &&
+                metatiles[i][2] == tiles[2] && metatiles[i][3] == tiles[3]) {
+            return i;
+        }
+    }
+    if (metatile_count == MAX_METATILES) {
+        fprintf(stderr, "mapconv: more than %d metatiles\n", MAX_METATILES);
+        return -1;
+    }
+    for (int i = 0; i < 4; i++) {
+        metatiles[metatile_count][i] = tiles[i];
+    }
+    return metatile_count++;
+}
+
+/* function to find a chunk, adding it if it is new */
+int find_chunk(const unsigned char* chunk) {
+    for (int i = 0; i < chunk_count; i++) {
+        int same = 1;
+        for (int j = 0; j < CHUNK_SIZE * CHUNK_SIZE; j++) {
+            if (chunks[i][j] != chunk[j]) {
+                same = 0;
+                break;
+            }
+        }
+        if (same) {
+            return i;
+        }
+    }
+    if (chunk_count == MAX_CHUNKS) {
+        fprintf(stderr, "mapconv: more than %d chunks\n", MAX_CHUNKS);
+        return -1;
+    }
+    for (int j = 0; j < CHUNK_SIZE * CHUNK_SIZE; j++) {
+        chunks[chunk_count][j] = chunk[j];
+    }
+    return chunk_count++;
+}
+
+/* function to print an array in the style of the other asset headers */
+void print_array(const char* type, const char* name, const void* data, int count, int size) {
+    int per_line = size == 4 ? 6 : 9;
+    printf("const %s %s [] = {\n", type, name);
+    for (int i = 0; i < count; i++) {
+        if (i % per_line == 0) {
+            printf("    ");
+        }
+        if (size == 4) {
+            printf("0x%08x", ((const unsigned int*) data)[i]);
+        } else if (size == 2) {
+            printf("0x%04x", ((const unsigned short*) data)[i]);
+        } else {
+            printf("0x%02x", ((const unsigned char*) data)[i]);
+        }
+        if (i != count - 1) {
+            printf(", ");
+        }
+        if (i % per_line == per_line - 1 || i == count - 1) {
+            printf("\n");
+        }
+    }
+    printf("};\n\n");
+}
+
+int main() {
+    int map_chunk[MAP_CHUNKS_WIDTH * MAP_CHUNKS_WIDTH];
+
+    /* cut the map into chunks of metatiles */
+    for (int cy = 0; cy < MAP_CHUNKS_WIDTH; cy++) {
+        for (int cx = 0; cx < MAP_CHUNKS_WIDTH; cx++) {
+            unsigned char chunk[CHUNK_SIZE * CHUNK_SIZE];
+            for (int my = 0; my < CHUNK_SIZE; my++) {
+                for (int mx = 0; mx < CHUNK_SIZE; mx++) {
+                    int tx = (cx * CHUNK_SIZE + mx) * 2;
+                    int ty = (cy * CHUNK_SIZE + my) * 2;
+                    unsigned short tiles[4] = {
+                        gta_map[ty * gta_map_width + tx],
+                        gta_map[ty * gta_map_width + tx + 1],
+                        gta_map[(ty + 1) * gta_map_width + tx],
+                        gta_map[(ty + 1) * gta_map_width + tx + 1]
+                    };
+                    int metatile = find_metatile(tiles);
+                    if (metatile < 0) {
+                        return 1;
+                    }
+                    chunk[my * CHUNK_SIZE + mx] = metatile;
+                }
+            }
+            int found = find_chunk(chunk);
+            if (found < 0) {
+                return 1;
+            }
+            map_chunk[cy * MAP_CHUNKS_WIDTH + cx] = found;
+        }
+    }
+
+    unsigned char world[WORLD_CHUNKS_WIDTH * WORLD_CHUNKS_HEIGHT];
+    for (int y = 0; y < WORLD_CHUNKS_HEIGHT; y++) {
+        for (int x = 0; x < WORLD_CHUNKS_WIDTH; x++) {
+            world[y * WORLD_CHUNKS_WIDTH + x] = map_chunk[world_layout[y][x]];
+        }
+    }
+
+    /* classify every tile of the world */
+    int tiles_width = WORLD_CHUNKS_WIDTH * CHUNK_SIZE * 2;
+    int tiles_height = WORLD_CHUNKS_HEIGHT * CHUNK_SIZE * 2;
+    int words_per_row = tiles_width / TILES_PER_WORD;
+    static unsigned int collision[WORLD_CHUNKS_WIDTH * WORLD_CHUNKS_HEIGHT * CHUNK_SIZE * CHUNK_SIZE * 4 / TILES_PER_WORD];
+    for (int ty = 0; ty < tiles_height; ty++) {
+        for (int tx = 0; tx < tiles_width; tx++) {
+            int mx = tx / 2, my = ty / 2;
+            int chunk = world[(my / CHUNK_SIZE) * WORLD_CHUNKS_WIDTH + mx / CHUNK_SIZE];
+            int metatile = chunks[chunk][(my % CHUNK_SIZE) * CHUNK_SIZE + mx % CHUNK_SIZE];
+            int tile = metatiles[metatile][(ty % 2) * 2 + tx % 2] & 0x3ff;
+            unsigned int class = tile < CLASSIFIED_TILES ? tile_classes[tile] : SOLID;
+            collision[ty * words_per_row + tx / TILES_PER_WORD] |= class << ((tx % TILES_PER_WORD) * 2);
+        }
+    }
+
+    int flat = WORLD_CHUNKS_WIDTH * WORLD_CHUNKS_HEIGHT * CHUNK_SIZE * CHUNK_SIZE * 4 * 2;
+    int packed = metatile_count * 4 * 2 + chunk_count * CHUNK_SIZE * CHUNK_SIZE + sizeof(world);
+
+    printf("/* gta_world.h\n");
+    printf(" * generated by mapconv from gta_map.h\n");
+    printf(" * %d bytes, the same world as a flat tile map would be %d bytes */\n\n", packed, flat);
+    printf("#define metatile_count %d\n", metatile_count);
+    printf("#define chunk_size %d\n", CHUNK_SIZE);
+    printf("#define chunk_count %d\n", chunk_count);
+    printf("#define world_chunks_width %d\n", WORLD_CHUNKS_WIDTH);
+    printf("#define world_chunks_height %d\n", WORLD_CHUNKS_HEIGHT);
+    printf("#define collision_words_per_row %d\n\n", words_per_row);
+
+    printf("/* the four tile map entries of each metatile: top left, top right, bottom left, bottom right */\n");
+    print_array("unsigned short", "metatiles", metatiles, metatile_count * 4, 2);
+    printf("/* the metatile at each place in each chunk, row by row */\n");
+    print_array("unsigned char", "chunks", chunks, chunk_count * CHUNK_SIZE * CHUNK_SIZE, 1);
+    printf("/* the chunk at each place in the world, row by row */\n");
+    print_array("unsigned char", "world_chunks", world, sizeof(world), 1);
+    printf("/* the collision class of each world tile, 2 bits each and 16 to a word, row by row */\n");
+    print_array("unsigned int", "collision_map", collision, words_per_row * tiles_height, 4);
+
+    fprintf(stderr, "mapconv: %d metatiles, %d chunks, %d bytes against %d for gta_map, %d flat\n",
+            metatile_count, chunk_count, packed, (int) sizeof(gta_map), flat);
+    return 0;
+}
@@ -0,0 +1,300 @@
+/* memreport.c
+ * prints how much rom, iwram, ewram and vram the game uses, by region, by symbol and by
+ * asset, and fails when a region is over the budget set for it
+ *
+ * link the game with -Wl,-Map=gta.map, then build and run on the host:
+ *     gcc -o memreport tools/memreport.c && ./memreport gta.map tools/budgets.txt
+ *
+ * the budget file has a region name and a number of bytes on each line, # starts a comment */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../assets.h"
+#include "../font.h"
+#include "../gta_world.h"
+#include "../luts.h"
+#include "../sounds.h"
+#include "../vram.h"
+
+/* the minimap is a pixel per metatile of the world, in 8 bit tiles after the font */
+#define MINIMAP_BYTES (world_chunks_width * chunk_size * world_chunks_height * chunk_size)
+
+/* the memory regions, found from the address a section is at */
+#define ROM 0
+#define IWRAM 1
+#define EWRAM 2
+#define REGIONS 3
+
+const char* region_names[REGIONS] = {"rom", "iwram", "ewram"};
+
+/* the whole of each region, used when the budget file leaves one out */
+unsigned int region_budgets[REGIONS] = {0x2000000, 0x8000, 0x40000};
+unsigned int region_used[REGIONS];
+
+/* symbols listed for each region */
+#define TOP_SYMBOLS 15
+
+#define MAX_SECTIONS 4096
+#define MAX_SYMBOLS 8192
+
+/* an input section from the map, and the symbols in it */
+struct Section {
+    char name[256];
+    unsigned int address;
+    unsigned int size;
+};
+
+struct Symbol {
+    char name[256];
+    unsigned int address;
+    unsigned int size;
+    int section;
+};
+
+struct Section sections[MAX_SECTIONS];
+int section_count = 0;
+struct Symbol symbols[MAX_SYMBOLS];
+int symbol_count = 0;
+
+/* function to find the region an address is in, or -1 for none */
+int region_of(unsigned int address) {
+    switch (address >> 24) {
+        case 0x08: case 0x09: return ROM;
+        case 0x03: return IWRAM;
+        case 0x02: return EWRAM;
+        default: return -1;
+    }
+}
+
+/* function to compare symbols by address for qsort */
+int compare_address(const void* a, const void* b) {
+    const struct Symbol* x = a;
+    const struct Symbol* y = b;
+    return (x->address > y->address) - (x->address < y->address);
+}
+
+/* function to compare symbols by size, largest first, for qsort */
+int compare_size(const void* a, const void* b) {
+    const struct Symbol* x = a;
+    const struct Symbol* y = b;
+    return (x->size < y->size) - (x->size > y->size);
+}
+
+/* function to read the output sections, input sections and symbols from a gnu ld map */
+int read_map(const char* path) {
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        perror(path);
+        return 0;
+    }
+
+    char line[512];
+    char pending[512] = "";
+    char entry[1024];
+    int in_map = 0;
+    while (fgets(line, sizeof(line), file)) {
+        if (!in_map) {
+            in_map = strncmp(line, "Linker script and memory map", 28) == 0;
+            continue;
+        }
+
+        char name[256];
+        char rest[256];
+        unsigned int address;
+        unsigned int size;
+        unsigned int load;
+
+        /* a long section name is on a line of its own, with the address and size on the next */
+        if ((line[0] == '.' || (line[0] == ' ' && line[1] == '.')) && sscanf(line, "%255s %255s", name, rest) == 1) {
+            strcpy(pending, line);
+            pending[strcspn(pending, "\n")] = '\0';
+            continue;
+        }
+        snprintf(entry, sizeof(entry), "%s%s", pending, line);
+        pending[0] = '\0';
+
+        if (entry[0] == '.') {
+            /* an output section, which counts towards rom as well when it is loaded from there */
+            if (sscanf(entry, "%255s %x %x", name, &address, &size) == 3 && size) {
+                int region = region_of(address);
+                if (region >= 0) {
+                    region_used[region] += size;
+                }
+                char* at = strstr(entry, "load address");
+                if (at && sscanf(at, "load address %x", &load) == 1 && region_of(load) == ROM && region != ROM) {
+                    region_used[ROM] += size;
+                }
+            }
+        } else if (entry[0] == ' ' && (entry[1] == '.' || strncmp(entry, " COMMON", 7) == 0)) {
+            /* an input section from one object file */
+            if (sscanf(entry, "%255s %x %x", name, &address, &size) == 3 && size && region_of(address) >= 0
+                    && section_count < MAX_SECTIONS) {
+                struct Section* section = &sections[section_count++];
+                snprintf(section->name, sizeof(section->name), "%s", name);
+                section->address = address;
+                section->size = size;
+            }
+        } else if (sscanf(entry, " %x %255s %255s", &address, name, rest) == 2 && section_count) {
+            /* a symbol, which belongs to the input section listed just before it */
+            struct Section* section = &sections[section_count - 1];
+            if (address >= section->address && address < section->address + section->size
+                    && symbol_count < MAX_SYMBOLS) {
+                struct Symbol* symbol = &symbols[symbol_count++];
+                snprintf(symbol->name, sizeof(symbol->name), "%s", name);
+                symbol->address = address;
+                symbol->section = section_count - 1;
+            }
+        }
+    }
+    fclose(file);
+
+    if (!in_map) {
+        fprintf(stderr, "memreport: %s is not a linker map\n", path);
+        return 0;
+    }
+
+    /* a symbol runs up to the next one in its section, or the end of the section */
+    qsort(symbols, symbol_count, sizeof(struct Symbol), compare_address);
+    for (int i = 0; i < symbol_count; i++) {
+        struct Section* section = &sections[symbols[i].section];
+        unsigned int end = section->address + section->size;
+        if (i + 1 < symbol_count && symbols[i + 1].section == symbols[i].section) {
+            end = symbols[i + 1].address;
+        }
+        symbols[i].size = end - symbols[i].address;
+    }
+    return 1;
+}
+
+/* function to read the budget file */
+int read_budgets(const char* path) {
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        perror(path);
+        return 0;
+    }
+
+    char line[256];
+    int number = 0;
+    while (fgets(line, sizeof(line), file)) {
+        number++;
+        char* comment = strchr(line, '#');
+        if (comment) {
+            *comment = '\0';
+        }
+        char name[64];
+        unsigned int bytes;
+        int fields = sscanf(line, "%63s %i", name, &bytes);
+        if (fields <= 0) {
+            continue;
+        }
+        int region;
+        for (region = 0; region < REGIONS && strcmp(name, region_names[region]); region++) { }
+        if (fields != 2 || region == REGIONS) {
+            fprintf(stderr, "memreport: %s:%d: expected a region and a number of bytes\n", path, number);
+            fclose(file);
+            return 0;
+        }
+        region_budgets[region] = bytes;
+    }
+    fclose(file);
+    return 1;
+}
+
+/* function to print the largest symbols in a region */
+void report_symbols(int region) {
+    static struct Symbol sorted[MAX_SYMBOLS];
+    int count = 0;
+    for (int i = 0; i < symbol_count; i++) {
+        if (region_of(symbols[i].address) == region) {
+            sorted[count++] = symbols[i];
+        }
+    }
+    qsort(sorted, count, sizeof(struct Symbol), compare_size);
+
+    printf("largest in %s\n", region_names[region]);
+    for (int i = 0; i < count && i < TOP_SYMBOLS; i++) {
+        printf("  %-32s %8u  %s\n", sorted[i].name, sorted[i].size, sections[sorted[i].section].name);
+    }
+    printf("\n");
+}
+
+/* function to print one asset */
+void report_asset(const char* name, unsigned int size) {
+    printf("  %-32s %8u\n", name, size);
+}
+
+/* function to print one block of vram */
+void report_block(const char* block, unsigned int start, unsigned int capacity, unsigned int used,
+        const char* contents) {
+    printf("  %-20s 0x%05x %6u %6u %5.1f%%  %s\n", block, start, capacity, used, used * 100.0 / capacity, contents);
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "usage: memreport gta.map [budgets.txt]\n");
+        return 1;
+    }
+    if (!read_map(argv[1]) || (argc == 3 && !read_budgets(argv[2]))) {
+        return 1;
+    }
+
+    printf("region          used   budget\n");
+    int over = 0;
+    for (int i = 0; i < REGIONS; i++) {
+        printf("  %-8s %8u %8u %5.1f%%\n", region_names[i], region_used[i], region_budgets[i],
+            region_used[i] * 100.0 / region_budgets[i]);
+        if (region_used[i] > region_budgets[i]) {
+            over = 1;
+        }
+    }
+    printf("\n");
+
+    for (int i = 0; i < REGIONS; i++) {
+        report_symbols(i);
+    }
+
+    /* the generated assets, all of which sit in rom */
+    printf("assets in rom\n");
+    report_asset("background_data", sizeof(background_data));
+    report_asset("cars_data", sizeof(cars_data));
+    report_asset("bg_palette_data", sizeof(bg_palette_data));
+    report_asset("obj_palette_data", sizeof(obj_palette_data));
+    report_asset("font_data", sizeof(font_data));
+    report_asset("font_colors", sizeof(font_colors));
+    report_asset("text_remap", sizeof(text_remap));
+    report_asset("metatiles", sizeof(metatiles));
+    report_asset("chunks", sizeof(chunks));
+    report_asset("world_chunks", sizeof(world_chunks));
+    report_asset("collision_map", sizeof(collision_map));
+    report_asset("sin_lut", sizeof(sin_lut));
+    report_asset("reciprocal_lut", sizeof(reciprocal_lut));
+    report_asset("sound_engine", sizeof(sound_engine));
+    report_asset("sound_siren", sizeof(sound_siren));
+    report_asset("sound_crash", sizeof(sound_crash));
+    printf("\n");
+
+    /* what each block of vram holds once the game is set up */
+    printf("vram                 start   size   used\n");
+    report_block("char block 0", 0, CHAR_BLOCK_SIZE, background_width * background_height, "city tiles");
+    report_block("char block 1", CHAR_BLOCK_SIZE, CHAR_BLOCK_SIZE, font_glyphs * 64 + MINIMAP_BYTES,
+        "font and minimap");
+    report_block("screen blocks 16-19", LAYOUT_SCREEN_BLOCK * SCREEN_BLOCK_SIZE, 4 * SCREEN_BLOCK_SIZE,
+        4 * SCREEN_BLOCK_SIZE, "city map");
+    report_block("screen blocks 20-21", AFFINE_SCREEN_BLOCK * SCREEN_BLOCK_SIZE, 2 * SCREEN_BLOCK_SIZE,
+        2 * SCREEN_BLOCK_SIZE, "affine city map");
+    report_block("screen block 24", TEXT_SCREEN_BLOCK * SCREEN_BLOCK_SIZE, SCREEN_BLOCK_SIZE,
+        SCREEN_BLOCK_SIZE, "text");
+    report_block("obj memory", 0x10000, OBJ_MEMORY_SIZE, OBJ_TILE_END * 32, "cars, particles, blips");
+    printf("\n");
+
+    for (int i = 0; i < REGIONS; i++) {
+        if (region_used[i] > region_budgets[i]) {
+            fprintf(stderr, "memreport: %s is %u bytes over its budget of %u\n", region_names[i],
+                region_used[i] - region_budgets[i], region_budgets[i]);
+        }
+    }
+    return over;
+}
@@ -0,0 +1,250 @@
+/* palpack.c
+ * merges the palettes of the png2gba assets, one palette per layer, dropping unused and
+ * duplicate colors and packing each asset's colors into shared 16 color banks, then prints
+ * the remapped pixel data and the packed palettes as assets.h
+ *
+ * the font is packed to fewer bits per pixel by fontpack, so for it only the remapping of
+ * its color indices is printed
+ *
+ * build and run on the host:
+ *     gcc -o palpack tools/palpack.c && ./palpack > assets.h */
+
+#include <stdio.h>
+
+#include "../background.h"
+#include "../cars.h"
+#include "../text.h"
+
+/* banks of 16 colors with entry 0 left for transparency, so assets could go to 4 bits per pixel */
+#define BANK_SIZE 16
+#define MAX_BANKS 16
+#define MAX_COLORS (MAX_BANKS * (BANK_SIZE - 1))
+
+/* an asset, the layer whose palette it uses, and whether its pixels go in assets.h */
+struct Asset {
+    const char* name;
+    const unsigned char* data;
+    int width, height;
+    const unsigned short* palette;
+    int layer;
+    int pixels;
+    unsigned char remap[256];
+};
+
+/* the layers, the background palette is shared by the city and the font */
+#define BG_LAYER 0
+#define OBJ_LAYER 1
+#define NUM_LAYERS 2
+const char* layer_names[NUM_LAYERS] = {"bg", "obj"};
+
+struct Asset assets[] = {
+    {"background", background_data, background_width, background_height, background_palette, BG_LAYER, 1},
+    {"text", text_data, text_width, text_height, text_palette, BG_LAYER, 0},
+    {"cars", cars_data, cars_width, cars_height, cars_palette, OBJ_LAYER, 1}
+};
+#define NUM_ASSETS (int) (sizeof(assets) / sizeof(assets[0]))
+
+/* the palette being built for each layer */
+unsigned short palettes[NUM_LAYERS][MAX_BANKS * BANK_SIZE];
+int bank_counts[NUM_LAYERS];
+int bank_used[NUM_LAYERS][MAX_BANKS];
+
+/* function to get the squared distance between two 15 bit colors */
+int color_distance(unsigned short a, unsigned short b) {
+    int dr = (a & 31) - (b & 31);
+    int dg = ((a >> 5) & 31) - ((b >> 5) & 31);
+    int db = ((a >> 10) & 31) - ((b >> 10) & 31);
+    return dr * dr + dg * dg + db * db;
+}
+
+/* function to find the colors an asset actually uses, merging the closest ones while there
+ * are too many for the layer, returns how many are left */
+int asset_colors(struct Asset* asset, unsigned short* colors) {
+    int used[256] = {0};
+    int count = 0;
+
+    for (int i = 0; i < asset->width * asset->height; i++) {
+        used[asset->data[i]] = 1;
+    }
+    for (int i = 1; i < 256; i++) {
+        if (!used[i]) {
+            continue;
+        }
+        int j;
+        for (j = 0; j < count && colors[j] != asset->palette[i]; j++) { }
+        if (j == count) {
+            colors[count++] = asset->palette[i];
+        }
+    }
+
+    while (count > MAX_COLORS) {
+        int drop = 1, best = 1 << 30;
+        for (int a = 0; a < count; a++) {
+            for (int b = a + 1; b < count; b++) {
+                int distance = color_distance(colors[a], colors[b]);
+                if (distance < best) {
+                    best = distance;
+                    drop = b;
+                }
+            }
+        }
+
+        /* the pixels using the dropped color are remapped to the nearest one left */
+        colors[drop] = colors[--count];
+    }
+    return count;
+}
+
+/* function to find a color in a bank, or -1 */
+int bank_find(int layer, int bank, unsigned short color) {
+    for (int i = 1; i < bank_used[layer][bank]; i++) {
+        if (palettes[layer][bank * BANK_SIZE + i] == color) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* function to place an asset's colors, sharing a bank with earlier assets when they fit */
+int place_asset(struct Asset* asset) {
+    unsigned short colors[256];
+    int count = asset_colors(asset, colors);
+    int layer = asset->layer;
+    int first = -1;
+
+    /* an asset with up to 15 colors goes in the first bank with room for the ones it lacks */
+    if (count < BANK_SIZE) {
+        for (int bank = 0; bank < bank_counts[layer] && first < 0; bank++) {
+            int missing = 0;
+            for (int i = 0; i < count; i++) {
+                if (bank_find(layer, bank, colors[i]) < 0) {
+                    missing++;
+                }
+            }
+            if (bank_used[layer][bank] + missing <= BANK_SIZE) {
+                first = bank;
+            }
+        }
+    }
+    if (first < 0) {
+        first = bank_counts[layer];
+    }
+
+    /* add the colors, running on into later banks for assets with more than 15 */
+    int bank = first;
+    for (int i = 0; i < count; i++) {
+        int found = -1;
+        for (int b = first; b <= bank && b < bank_counts[layer] && found < 0; b++) {
+            int entry = bank_find(layer, b, colors[i]);
+            if (entry >= 0) {
+                found = b * BANK_SIZE + entry;
+            }
+        }
+        if (found >= 0) {
+            continue;
+        }
+        if (bank >= bank_counts[layer]) {
+            bank_counts[layer] = bank + 1;
+            bank_used[layer][bank] = 1;
+            palettes[layer][bank * BANK_SIZE] = asset->palette[0];
+        }
+        if (bank_used[layer][bank] == BANK_SIZE) {
+            bank++;
+            if (bank == MAX_BANKS) {
+                fprintf(stderr, "palpack: out of banks for %s\n", asset->name);
+                return 0;
+            }
+            bank_counts[layer] = bank + 1;
+            bank_used[layer][bank] = 1;
+            palettes[layer][bank * BANK_SIZE] = asset->palette[0];
+        }
+        palettes[layer][bank * BANK_SIZE + bank_used[layer][bank]++] = colors[i];
+    }
+
+    /* remap every index to the nearest color in the asset's banks, index 0 stays transparent */
+    asset->remap[0] = 0;
+    for (int i = 1; i < 256; i++) {
+        int best = 0, best_distance = 1 << 30;
+        for (int b = first; b < bank_counts[layer]; b++) {
+            for (int entry = 1; entry < bank_used[layer][b]; entry++) {
+                int distance = color_distance(asset->palette[i], palettes[layer][b * BANK_SIZE + entry]);
+                if (distance < best_distance) {
+                    best_distance = distance;
+                    best = b * BANK_SIZE + entry;
+                }
+            }
+        }
+        asset->remap[i] = best;
+    }
+    return 1;
+}
+
+/* function to print an array in the style of png2gba */
+void print_array(const char* type, const char* name, const void* data, int count, int size) {
+    printf("const %s %s [] = {\n", type, name);
+    for (int i = 0; i < count; i++) {
+        if (i % (size == 2 ? 9 : 12) == 0) {
+            printf("    ");
+        }
+        if (size == 2) {
+            printf("0x%04x", ((const unsigned short*) data)[i]);
+        } else {
+            printf("0x%02x", ((const unsigned char*) data)[i]);
+        }
+        if (i != count - 1) {
+            printf(", ");
+        }
+        if (i % (size == 2 ? 9 : 12) == (size == 2 ? 8 : 11) || i == count - 1) {
+            printf("\n");
+        }
+    }
+    printf("};\n\n");
+}
+
+int main() {
+    for (int i = 0; i < NUM_ASSETS; i++) {
+        if (!place_asset(&assets[i])) {
+            return 1;
+        }
+    }
+
+    printf("/* assets.h\n");
+    printf(" * generated by palpack from background.h, cars.h and text.h */\n\n");
+
+    for (int layer = 0; layer < NUM_LAYERS; layer++) {
+        int size = bank_counts[layer] * BANK_SIZE;
+        char name[32];
+        printf("#define %s_palette_size %d\n", layer_names[layer], size);
+        sprintf(name, "%s_palette_data", layer_names[layer]);
+        print_array("unsigned short", name, palettes[layer], size, 2);
+        fprintf(stderr, "palpack: %s palette %d banks\n", layer_names[layer], bank_counts[layer]);
+    }
+
+    static unsigned char pixels[256 * 256];
+    for (int i = 0; i < NUM_ASSETS; i++) {
+        struct Asset* asset = &assets[i];
+        char name[32];
+
+        /* for assets packed elsewhere, print the new index of each index up to the highest used */
+        if (!asset->pixels) {
+            int highest = 0;
+            for (int j = 0; j < asset->width * asset->height; j++) {
+                if (asset->data[j] > highest) {
+                    highest = asset->data[j];
+                }
+            }
+            sprintf(name, "%s_remap", asset->name);
+            print_array("unsigned char", name, asset->remap, highest + 1, 1);
+            continue;
+        }
+
+        for (int j = 0; j < asset->width * asset->height; j++) {
+            pixels[j] = asset->remap[asset->data[j]];
+        }
+        printf("#define %s_width %d\n", asset->name, asset->width);
+        printf("#define %s_height %d\n\n", asset->name, asset->height);
+        sprintf(name, "%s_data", asset->name);
+        print_array("unsigned char", name, pixels, asset->width * asset->height, 1);
+    }
+    return 0;
+}
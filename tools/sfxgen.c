@@ -0,0 +1,88 @@
+/* sfxgen.c
+ * makes the engine, siren and crash sounds as signed 8 bit samples and prints them as sounds.h
+ *
+ * build and run on the host:
+ *     gcc -o sfxgen tools/sfxgen.c -lm && ./sfxgen > sounds.h */
+
+#include <math.h>
+#include <stdio.h>
+
+/* the mixer's rate, 304 samples a frame */
+#define RATE 18157
+
+/* the engine is one period of a buzzy wave, played faster as the car speeds up */
+#define ENGINE_LENGTH 256
+
+/* the siren is one period of a soft square wave, the game bends its pitch to make it wail */
+#define SIREN_LENGTH 64
+
+/* the crash is half a second of noise dying away */
+#define CRASH_LENGTH (RATE / 2)
+
+/* function to print a sound as a signed char array */
+void print_sound(const char* name, const signed char* samples, int length) {
+    printf("#define %s_length %d\n", name, length);
+    printf("const signed char %s [] = {\n", name);
+    for (int i = 0; i < length; i++) {
+        if (i % 12 == 0) {
+            printf("    ");
+        }
+        printf("%d", samples[i]);
+        if (i != length - 1) {
+            printf(", ");
+        }
+        if (i % 12 == 11 || i == length - 1) {
+            printf("\n");
+        }
+    }
+    printf("};\n\n");
+}
+
+/* function to keep a sample in range */
+signed char clamp(double value) {
+    if (value > 127) {
+        return 127;
+    }
+    if (value < -128) {
+        return -128;
+    }
+    return (signed char) lround(value);
+}
+
+int main() {
+    static signed char engine[ENGINE_LENGTH];
+    static signed char siren[SIREN_LENGTH];
+    static signed char crash[CRASH_LENGTH];
+
+    /* a sawtooth with some of the fourth harmonic on top, so it rumbles */
+    for (int i = 0; i < ENGINE_LENGTH; i++) {
+        double phase = (double) i / ENGINE_LENGTH;
+        double saw = 1.0 - 2.0 * phase;
+        double buzz = sin(phase * 8.0 * M_PI);
+        engine[i] = clamp(saw * 80 + buzz * 30);
+    }
+
+    /* the first two odd harmonics of a square wave */
+    for (int i = 0; i < SIREN_LENGTH; i++) {
+        double phase = (double) i / SIREN_LENGTH * 2.0 * M_PI;
+        siren[i] = clamp(sin(phase) * 100 + sin(phase * 3.0) * 25);
+    }
+
+    /* noise through a simple low pass, dying away exponentially */
+    unsigned int seed = 12345;
+    double smooth = 0;
+    for (int i = 0; i < CRASH_LENGTH; i++) {
+        seed = seed * 1103515245 + 12345;
+        double noise = ((int) ((seed >> 16) & 0xff) - 128) / 128.0;
+        smooth += (noise - smooth) * 0.5;
+        crash[i] = clamp(smooth * 160 * exp(-6.0 * i / CRASH_LENGTH));
+    }
+
+    printf("/* sounds.h\n");
+    printf(" * generated by sfxgen */\n\n");
+    printf("#define sound_rate %d\n\n", RATE);
+    print_sound("sound_engine", engine, ENGINE_LENGTH);
+    print_sound("sound_siren", siren, SIREN_LENGTH);
+    print_sound("sound_crash", crash, CRASH_LENGTH);
+    return 0;
+}
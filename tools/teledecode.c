@@ -0,0 +1,214 @@
+/* teledecode.c
+ * reads the frame telemetry the game saves to sram and prints a report of
+ * frame times, overruns, dma traffic, car counts and interrupts
+ *
+ * build and run on the host, on the save file from the cartridge or emulator:
+ *     gcc -o teledecode tools/teledecode.c && ./teledecode gta.sav */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* the header the game writes before the frames */
+#define TELEMETRY_MAGIC 0x54415447
+#define TELEMETRY_VERSION 2
+#define TELEMETRY_HEADER 24
+#define FRAME_BYTES 12
+
+/* the interrupt stats written after the header, 4 words for each interrupt */
+#define INTERRUPT_BYTES 16
+
+/* frame time histogram buckets, each a tenth of a frame, with the last for anything longer */
+#define BUCKETS 11
+#define BAR_WIDTH 50
+
+struct Frame {
+    unsigned int cycles;
+    unsigned int dma_bytes;
+    unsigned int vblanks;
+    unsigned int entities;
+    unsigned int interrupt_cycles;
+    unsigned int interrupts;
+};
+
+/* names of the interrupts, in the order of their bits */
+const char* interrupt_names[] = {
+    "vblank", "hblank", "vcount", "timer 0", "timer 1", "timer 2", "timer 3",
+    "serial", "dma 0", "dma 1", "dma 2", "dma 3", "keypad", "gamepak"
+};
+
+/* function to read a little endian value */
+unsigned int read_value(const unsigned char* data, int bytes) {
+    unsigned int value = 0;
+    for (int i = 0; i < bytes; i++) {
+        value |= data[i] << (i * 8);
+    }
+    return value;
+}
+
+/* function to compare values for qsort */
+int compare(const void* a, const void* b) {
+    unsigned int x = *(const unsigned int*) a;
+    unsigned int y = *(const unsigned int*) b;
+    return (x > y) - (x < y);
+}
+
+/* function to find a percentile of sorted values */
+unsigned int percentile(const unsigned int* sorted, int count, int percent) {
+    int index = (count * percent + 99) / 100 - 1;
+    if (index < 0) {
+        index = 0;
+    }
+    return sorted[index];
+}
+
+/* function to print the percentiles of one field */
+void report(const char* name, unsigned int* values, int count) {
+    unsigned long long total = 0;
+    for (int i = 0; i < count; i++) {
+        total += values[i];
+    }
+    qsort(values, count, sizeof(unsigned int), compare);
+    printf("%-12s mean %8llu  p50 %8u  p90 %8u  p99 %8u  max %8u\n", name, total / count,
+        percentile(values, count, 50), percentile(values, count, 90),
+        percentile(values, count, 99), values[count - 1]);
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: teledecode file.sav\n");
+        return 1;
+    }
+
+    FILE* file = fopen(argv[1], "rb");
+    if (!file) {
+        perror(argv[1]);
+        return 1;
+    }
+    static unsigned char data[0x10000];
+    int size = fread(data, 1, sizeof(data), file);
+    fclose(file);
+
+    if (size < TELEMETRY_HEADER || read_value(data, 4) != TELEMETRY_MAGIC) {
+        fprintf(stderr, "teledecode: %s has no telemetry in it\n", argv[1]);
+        return 1;
+    }
+    if (read_value(data + 4, 2) != TELEMETRY_VERSION || read_value(data + 6, 2) != FRAME_BYTES) {
+        fprintf(stderr, "teledecode: %s is from a different version of the game\n", argv[1]);
+        return 1;
+    }
+    int count = read_value(data + 8, 4);
+    unsigned int frame_count = read_value(data + 12, 4);
+    unsigned int frame_cycles = read_value(data + 16, 4);
+    int interrupt_count = read_value(data + 20, 4);
+    int start = TELEMETRY_HEADER + interrupt_count * INTERRUPT_BYTES;
+    if (interrupt_count > 32 || start > size) {
+        fprintf(stderr, "teledecode: %s has a broken header\n", argv[1]);
+        return 1;
+    }
+    if (count > (size - start) / FRAME_BYTES) {
+        count = (size - start) / FRAME_BYTES;
+    }
+    if (count == 0) {
+        fprintf(stderr, "teledecode: no frames were recorded\n");
+        return 1;
+    }
+
+    struct Frame* frames = malloc(count * sizeof(struct Frame));
+    for (int i = 0; i < count; i++) {
+        const unsigned char* record = data + start + i * FRAME_BYTES;
+        frames[i].cycles = read_value(record, 4);
+        frames[i].dma_bytes = read_value(record + 4, 2);
+        frames[i].vblanks = record[6];
+        frames[i].entities = record[7];
+        frames[i].interrupt_cycles = read_value(record + 8, 2);
+        frames[i].interrupts = read_value(record + 10, 2);
+    }
+
+    printf("%d frames recorded, the last %d of %u, at %u cycles a frame\n\n",
+        count, count, frame_count, frame_cycles);
+
+    /* overruns are frames that missed their vblank, and how many they missed */
+    int overruns = 0;
+    int missed = 0;
+    for (int i = 0; i < count; i++) {
+        if (frames[i].vblanks > 1) {
+            overruns++;
+            missed += frames[i].vblanks - 1;
+        }
+    }
+    printf("overruns: %d frames (%.2f%%), %d vblanks missed\n\n", overruns,
+        overruns * 100.0 / count, missed);
+
+    /* histogram of the work done each frame as a share of the frame */
+    int buckets[BUCKETS] = {0};
+    int largest = 0;
+    for (int i = 0; i < count; i++) {
+        int bucket = (unsigned long long) frames[i].cycles * 10 / frame_cycles;
+        if (bucket >= BUCKETS) {
+            bucket = BUCKETS - 1;
+        }
+        buckets[bucket]++;
+        if (buckets[bucket] > largest) {
+            largest = buckets[bucket];
+        }
+    }
+    printf("frame time\n");
+    for (int i = 0; i < BUCKETS; i++) {
+        if (i == BUCKETS - 1) {
+            printf("    >100%%   ");
+        } else {
+            printf("  %3d-%3d%%  ", i * 10, i * 10 + 10);
+        }
+        int width = buckets[i] * BAR_WIDTH / largest;
+        for (int j = 0; j < width; j++) {
+            putchar('#');
+        }
+        printf(" %d\n", buckets[i]);
+    }
+    printf("\n");
+
+    /* percentiles of each field */
+    unsigned int* values = malloc(count * sizeof(unsigned int));
+    for (int i = 0; i < count; i++) {
+        values[i] = frames[i].cycles;
+    }
+    report("cycles", values, count);
+    for (int i = 0; i < count; i++) {
+        values[i] = frames[i].vblanks;
+    }
+    report("vblanks", values, count);
+    for (int i = 0; i < count; i++) {
+        values[i] = frames[i].dma_bytes;
+    }
+    report("dma bytes", values, count);
+    for (int i = 0; i < count; i++) {
+        values[i] = frames[i].entities;
+    }
+    report("cars", values, count);
+    for (int i = 0; i < count; i++) {
+        values[i] = frames[i].interrupt_cycles;
+    }
+    report("irq cycles", values, count);
+    for (int i = 0; i < count; i++) {
+        values[i] = frames[i].interrupts;
+    }
+    report("irqs", values, count);
+
+    /* totals for each interrupt since boot, the latency being from the dispatcher to the handler */
+    printf("\ninterrupt        count   mean cycles   max cycles   max latency\n");
+    for (int i = 0; i < interrupt_count; i++) {
+        const unsigned char* stats = data + TELEMETRY_HEADER + i * INTERRUPT_BYTES;
+        unsigned int handled = read_value(stats, 4);
+        if (handled == 0) {
+            continue;
+        }
+        printf("%-10s %11u   %11u   %10u   %11u\n",
+            i < (int) (sizeof(interrupt_names) / sizeof(interrupt_names[0])) ? interrupt_names[i] : "?",
+            handled, read_value(stats + 4, 4) / handled, read_value(stats + 8, 4),
+            read_value(stats + 12, 4));
+    }
+
+    free(values);
+    free(frames);
+    return 0;
+}
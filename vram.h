@@ -0,0 +1,22 @@
+/* vram.h
+ * where everything goes in vram, shared by gta.c and tools/memreport.c so the report can not
+ * drift from the game, assets.h has to be included first */
+
+/* the sizes of the blocks of vram */
+#define CHAR_BLOCK_SIZE 0x4000
+#define SCREEN_BLOCK_SIZE 0x800
+#define OBJ_MEMORY_SIZE 0x8000
+
+/* the city background's map over screen blocks 16 to 19, the affine view's map in 20 and 21,
+ * and the text layer's map after them */
+#define LAYOUT_SCREEN_BLOCK 16
+#define AFFINE_SCREEN_BLOCK 20
+#define TEXT_SCREEN_BLOCK 24
+
+/* sprite memory in 32 byte tiles: the cars, then two tiles for each 8 bit particle shape,
+ * then two for each minimap blip, OBJ_TILE_END being the first tile nothing uses */
+#define PARTICLE_TILE ((cars_width * cars_height) / 32)
+#define PARTICLE_TILES (3 * 2)
+#define BLIP_TILE (PARTICLE_TILE + PARTICLE_TILES)
+#define BLIP_TILES (3 * 2)
+#define OBJ_TILE_END (BLIP_TILE + BLIP_TILES)